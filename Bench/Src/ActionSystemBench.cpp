@@ -0,0 +1,37 @@
+﻿#include "BenchHarness.h"
+
+#include <EditorKit/ActionSystem.h>
+
+#include <string>
+
+// ActionSystem：按验证器/顺序处理器数量扫描Execute，以及冻结键集合后的Execute
+EDITORKIT_BENCH_SUITE(ActionSystem)
+{
+    for (int64_t handlers : runner.Sweep({ 1, 16, 256 }, { 1, 16 }))
+    {
+        StringActionSystem actionSystem;
+        int64_t counter = 0;
+        for (int64_t i = 0; i < handlers; ++i)
+        {
+            actionSystem.AddValidator("execute", [](int value) -> bool { return value > 0; });
+            actionSystem.AddSequentialProcessor("execute", [&counter](int value) { counter += value; });
+        }
+        for (int i = 0; i < 64; ++i)
+        {
+            actionSystem.AddSequentialProcessor("other_" + std::to_string(i), [](int) {});
+        }
+
+        const std::string key = "execute";
+        runner.Run("Execute", { { "handlers", handlers } }, [&]()
+            {
+                DoNotOptimize(actionSystem.Execute(key, 1).success);
+            });
+
+        actionSystem.Freeze();
+        runner.Run("ExecuteFrozen", { { "handlers", handlers } }, [&]()
+            {
+                DoNotOptimize(actionSystem.Execute(key, 1).success);
+            });
+        DoNotOptimize(counter);
+    }
+}
@@ -0,0 +1,403 @@
+﻿#pragma once
+
+#include "BenchHarness.h"
+#include "BenchReport.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <ostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// 基准测试回归检查：合并多次运行的结果，读取基线JSON并逐项比较
+namespace BenchCompare
+{
+    // 基线中单个用例的统计值（纳秒/次）
+    struct BaselineEntry
+    {
+        double p50 = 0.0;
+        double p90 = 0.0;
+        double mean = 0.0;
+    };
+
+    /* 极简JSON读取器，只支持BenchReport::WriteJson输出所需的对象、数组、字符串、数字与true/false/null
+    *读取"benchmarks"数组中每个对象的"id"与数值字段，其他字段忽略
+    */
+    class JsonReader
+    {
+    public:
+        explicit JsonReader(const std::string& text) : text_(text)
+        {
+        }
+
+        bool ReadBaseline(std::map<std::string, BaselineEntry>& out)
+        {
+            SkipSpace();
+            if (!Consume('{'))
+            {
+                return false;
+            }
+            return ReadObjectBody([&](const std::string& key)
+                {
+                    if (key != "benchmarks")
+                    {
+                        return SkipValue();
+                    }
+                    return ReadArray([&]() { return ReadBenchmark(out); });
+                });
+        }
+
+    private:
+        template<typename OnMember>
+        bool ReadObjectBody(OnMember onMember)
+        {
+            SkipSpace();
+            if (Consume('}'))
+            {
+                return true;
+            }
+            while (true)
+            {
+                std::string key;
+                SkipSpace();
+                if (!ReadString(key))
+                {
+                    return false;
+                }
+                SkipSpace();
+                if (!Consume(':') || !onMember(key))
+                {
+                    return false;
+                }
+                SkipSpace();
+                if (Consume('}'))
+                {
+                    return true;
+                }
+                if (!Consume(','))
+                {
+                    return false;
+                }
+            }
+        }
+
+        template<typename OnElement>
+        bool ReadArray(OnElement onElement)
+        {
+            SkipSpace();
+            if (!Consume('['))
+            {
+                return false;
+            }
+            SkipSpace();
+            if (Consume(']'))
+            {
+                return true;
+            }
+            while (true)
+            {
+                if (!onElement())
+                {
+                    return false;
+                }
+                SkipSpace();
+                if (Consume(']'))
+                {
+                    return true;
+                }
+                if (!Consume(','))
+                {
+                    return false;
+                }
+            }
+        }
+
+        bool ReadBenchmark(std::map<std::string, BaselineEntry>& out)
+        {
+            SkipSpace();
+            if (!Consume('{'))
+            {
+                return false;
+            }
+            std::string id;
+            BaselineEntry entry;
+            bool ok = ReadObjectBody([&](const std::string& key)
+                {
+                    SkipSpace();
+                    if (key == "id")
+                    {
+                        return ReadString(id);
+                    }
+                    if (key == "p50")
+                    {
+                        return ReadNumber(entry.p50);
+                    }
+                    if (key == "p90")
+                    {
+                        return ReadNumber(entry.p90);
+                    }
+                    if (key == "mean")
+                    {
+                        return ReadNumber(entry.mean);
+                    }
+                    return SkipValue();
+                });
+            if (ok && !id.empty())
+            {
+                out[id] = entry;
+            }
+            return ok;
+        }
+
+        bool SkipValue()
+        {
+            SkipSpace();
+            if (pos_ >= text_.size())
+            {
+                return false;
+            }
+            char c = text_[pos_];
+            if (c == '{')
+            {
+                ++pos_;
+                return ReadObjectBody([&](const std::string&) { return SkipValue(); });
+            }
+            if (c == '[')
+            {
+                return ReadArray([&]() { return SkipValue(); });
+            }
+            if (c == '"')
+            {
+                std::string ignored;
+                return ReadString(ignored);
+            }
+            if (text_.compare(pos_, 4, "true") == 0 || text_.compare(pos_, 4, "null") == 0)
+            {
+                pos_ += 4;
+                return true;
+            }
+            if (text_.compare(pos_, 5, "false") == 0)
+            {
+                pos_ += 5;
+                return true;
+            }
+            double ignored = 0.0;
+            return ReadNumber(ignored);
+        }
+
+        bool ReadString(std::string& out)
+        {
+            if (!Consume('"'))
+            {
+                return false;
+            }
+            out.clear();
+            while (pos_ < text_.size())
+            {
+                char c = text_[pos_++];
+                if (c == '"')
+                {
+                    return true;
+                }
+                if (c == '\\' && pos_ < text_.size())
+                {
+                    char escaped = text_[pos_++];
+                    switch (escaped)
+                    {
+                    case 'n': out += '\n'; break;
+                    case 't': out += '\t'; break;
+                    default: out += escaped; break;
+                    }
+                    continue;
+                }
+                out += c;
+            }
+            return false;
+        }
+
+        bool ReadNumber(double& out)
+        {
+            const char* begin = text_.c_str() + pos_;
+            char* end = nullptr;
+            out = std::strtod(begin, &end);
+            if (end == begin)
+            {
+                return false;
+            }
+            pos_ += static_cast<size_t>(end - begin);
+            return true;
+        }
+
+        void SkipSpace()
+        {
+            while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_])))
+            {
+                ++pos_;
+            }
+        }
+
+        bool Consume(char c)
+        {
+            if (pos_ < text_.size() && text_[pos_] == c)
+            {
+                ++pos_;
+                return true;
+            }
+            return false;
+        }
+
+        const std::string& text_;
+        size_t pos_ = 0;
+    };
+
+    // 读取基线文件，失败时返回false
+    inline bool LoadBaseline(const std::string& path, std::map<std::string, BaselineEntry>& out)
+    {
+        std::ifstream file(path);
+        if (!file)
+        {
+            return false;
+        }
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        std::string text = buffer.str();
+        return JsonReader(text).ReadBaseline(out);
+    }
+
+    inline double Median(std::vector<double> values)
+    {
+        if (values.empty())
+        {
+            return 0.0;
+        }
+        std::sort(values.begin(), values.end());
+        size_t middle = values.size() / 2;
+        return values.size() % 2 ? values[middle] : (values[middle - 1] + values[middle]) / 2.0;
+    }
+
+    /* 合并多次完整运行的结果：每个用例的各项统计值取各次运行的中位数
+    *单次运行内的p50已能抵消个别样本的抖动，再取多次运行的中位数可抵消整次运行受系统负载影响的偏差
+    */
+    inline std::vector<BenchResult> MedianOfRuns(const std::vector<std::vector<BenchResult>>& runs)
+    {
+        std::vector<BenchResult> merged;
+        if (runs.empty())
+        {
+            return merged;
+        }
+        for (size_t i = 0; i < runs.front().size(); ++i)
+        {
+            BenchResult result = runs.front()[i];
+            std::vector<double> mean, min, max, p50, p90, p99;
+            for (const auto& run : runs)
+            {
+                if (i >= run.size())
+                {
+                    continue;
+                }
+                mean.push_back(run[i].mean);
+                min.push_back(run[i].min);
+                max.push_back(run[i].max);
+                p50.push_back(run[i].p50);
+                p90.push_back(run[i].p90);
+                p99.push_back(run[i].p99);
+            }
+            result.mean = Median(mean);
+            result.min = Median(min);
+            result.max = Median(max);
+            result.p50 = Median(p50);
+            result.p90 = Median(p90);
+            result.p99 = Median(p99);
+            merged.push_back(std::move(result));
+        }
+        return merged;
+    }
+
+    // 回归判定阈值：p50相对基线的增幅同时超过tolerancePercent与minDeltaNs才算回归，后者用于忽略纳秒级用例的计时噪声
+    // 默认值与Bench/CMakeLists.txt中的EDITORKIT_BENCH_TOLERANCE、EDITORKIT_BENCH_MIN_DELTA_NS保持一致
+    struct Thresholds
+    {
+        double tolerancePercent = 50.0;
+        double minDeltaNs = 5.0;
+    };
+
+    // 对比结果计数
+    struct Summary
+    {
+        size_t compared = 0;    // 基线与当前结果都有的用例
+        size_t regressions = 0; // 其中回归的用例
+        size_t missing = 0;     // 基线中有、本次未运行的用例（只统计匹配filter的）
+    };
+
+    /* 比较当前结果与基线，输出逐项差异报告
+    *基线中没有的用例标记为new，基线中有但本次未运行的用例标记为missing（用例被删除或改名时基线需重新生成）
+    *filter与运行时的--filter相同，不匹配的基线用例不算missing
+    */
+    inline Summary Compare(std::ostream& out, const std::vector<BenchResult>& current,
+        const std::map<std::string, BaselineEntry>& baseline, const Thresholds& thresholds,
+        const std::string& filter = std::string())
+    {
+        Summary summary;
+        std::set<std::string> currentIds;
+        char line[256];
+        std::snprintf(line, sizeof(line), "%-56s %14s %14s %10s  %s\n", "benchmark", "baseline p50", "current p50", "delta", "status");
+        out << line;
+
+        for (const BenchResult& result : current)
+        {
+            std::string id = result.Id();
+            currentIds.insert(id);
+            auto it = baseline.find(id);
+            if (it == baseline.end())
+            {
+                std::snprintf(line, sizeof(line), "%-56s %14s %14.2f %10s  %s\n", id.c_str(), "-", result.p50, "-", "new");
+                out << line;
+                continue;
+            }
+
+            ++summary.compared;
+            double base = it->second.p50;
+            double delta = result.p50 - base;
+            double percent = base > 0.0 ? delta / base * 100.0 : 0.0;
+            const char* status = "ok";
+            if (percent > thresholds.tolerancePercent && delta > thresholds.minDeltaNs)
+            {
+                status = "REGRESSED";
+                ++summary.regressions;
+            }
+            else if (-percent > thresholds.tolerancePercent && -delta > thresholds.minDeltaNs)
+            {
+                status = "improved";
+            }
+            std::snprintf(line, sizeof(line), "%-56s %14.2f %14.2f %+9.1f%%  %s\n", id.c_str(), base, result.p50, percent, status);
+            out << line;
+        }
+
+        for (const auto& entry : baseline)
+        {
+            if (currentIds.count(entry.first) != 0 || (!filter.empty() && entry.first.find(filter) == std::string::npos))
+            {
+                continue;
+            }
+            ++summary.missing;
+            std::snprintf(line, sizeof(line), "%-56s %14.2f %14s %10s  %s\n", entry.first.c_str(), entry.second.p50, "-", "-", "missing");
+            out << line;
+        }
+
+        out << "对比 " << summary.compared << " 个用例（阈值 +" << BenchReport::FormatNumber(thresholds.tolerancePercent)
+            << "% 且 +" << BenchReport::FormatNumber(thresholds.minDeltaNs) << "ns），回归 " << summary.regressions
+            << " 个，缺失 " << summary.missing << " 个\n";
+        if (summary.compared == 0)
+        {
+            out << "没有任何用例与基线对应，请检查--filter/--quick参数或重新生成基线\n";
+        }
+        return summary;
+    }
+}
@@ -0,0 +1,230 @@
+﻿#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// 防止编译器把基准测试中的计算结果当作无用代码优化掉
+template<typename T>
+inline void DoNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+#endif
+}
+
+// 扫描参数（参数名, 取值）
+using BenchParams = std::vector<std::pair<std::string, int64_t>>;
+
+// 单个基准测试用例的统计结果，耗时单位为纳秒/次
+struct BenchResult
+{
+    std::string suite;          // 子系统名称
+    std::string name;           // 用例名称
+    BenchParams params;         // 扫描参数
+    uint64_t iterations = 0;    // 每个样本的迭代次数
+    std::vector<double> samples; // 每个样本的单次平均耗时
+    double mean = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+    double p50 = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+
+    // 唯一标识：suite/name/参数名=取值/...，用于过滤与基线对比
+    std::string Id() const
+    {
+        std::string id = suite + "/" + name;
+        for (const auto& param : params)
+        {
+            id += "/" + param.first + "=" + std::to_string(param.second);
+        }
+        return id;
+    }
+};
+
+// 运行选项
+struct BenchOptions
+{
+    std::string filter;             // 只运行Id包含该子串的用例，为空时全部运行
+    size_t sampleCount = 30;        // 每个用例的样本数
+    double minSampleTimeNs = 1e6;   // 每个样本的最短耗时，迭代次数据此自动校准
+    bool quick = false;             // 缩小扫描范围，用于快速检查
+};
+
+// 按线性插值计算已排序样本的百分位数
+inline double Percentile(const std::vector<double>& sorted, double percent)
+{
+    if (sorted.empty())
+    {
+        return 0.0;
+    }
+    double rank = percent / 100.0 * static_cast<double>(sorted.size() - 1);
+    size_t lower = static_cast<size_t>(rank);
+    size_t upper = std::min(lower + 1, sorted.size() - 1);
+    double fraction = rank - static_cast<double>(lower);
+    return sorted[lower] + (sorted[upper] - sorted[lower]) * fraction;
+}
+
+/* 基准测试运行器
+*每个用例先倍增迭代次数直到单个样本耗时达到minSampleTimeNs（同时起到预热作用），再采集sampleCount个样本
+*每个样本记录单次平均耗时，结果给出均值、最小/最大值及p50/p90/p99
+*/
+class BenchRunner
+{
+public:
+    explicit BenchRunner(const BenchOptions& options) : options_(options)
+    {
+    }
+
+    const BenchOptions& Options() const
+    {
+        return options_;
+    }
+
+    bool IsQuick() const
+    {
+        return options_.quick;
+    }
+
+    // 按quick选项选择扫描取值
+    std::vector<int64_t> Sweep(std::vector<int64_t> full, std::vector<int64_t> quick) const
+    {
+        return options_.quick ? quick : full;
+    }
+
+    // 设置之后运行的用例所属的子系统
+    void SetSuite(const std::string& suite)
+    {
+        suite_ = suite;
+    }
+
+    // 用例是否会被运行，可用于跳过开销较大的准备工作
+    bool Enabled(const std::string& name, const BenchParams& params = {}) const
+    {
+        return Matches(MakeResult(name, params).Id());
+    }
+
+    // 运行一个用例，operation每次调用计为一次迭代
+    template<typename Operation>
+    void Run(const std::string& name, const BenchParams& params, Operation&& operation)
+    {
+        BenchResult result = MakeResult(name, params);
+        if (!Matches(result.Id()))
+        {
+            return;
+        }
+
+        uint64_t iterations = 1;
+        while (true)
+        {
+            double elapsed = Measure(operation, iterations);
+            if (elapsed >= options_.minSampleTimeNs || iterations >= (uint64_t(1) << 40))
+            {
+                break;
+            }
+            // 按已测得的耗时估算所需迭代次数，至少翻倍、最多放大100倍
+            double scale = elapsed > 0.0 ? options_.minSampleTimeNs * 1.2 / elapsed : 100.0;
+            scale = std::min(std::max(scale, 2.0), 100.0);
+            iterations = static_cast<uint64_t>(static_cast<double>(iterations) * scale);
+        }
+
+        result.iterations = iterations;
+        result.samples.reserve(options_.sampleCount);
+        for (size_t i = 0; i < options_.sampleCount; ++i)
+        {
+            result.samples.push_back(Measure(operation, iterations) / static_cast<double>(iterations));
+        }
+
+        std::vector<double> sorted = result.samples;
+        std::sort(sorted.begin(), sorted.end());
+        double sum = 0.0;
+        for (double sample : sorted)
+        {
+            sum += sample;
+        }
+        result.mean = sorted.empty() ? 0.0 : sum / static_cast<double>(sorted.size());
+        result.min = sorted.empty() ? 0.0 : sorted.front();
+        result.max = sorted.empty() ? 0.0 : sorted.back();
+        result.p50 = Percentile(sorted, 50.0);
+        result.p90 = Percentile(sorted, 90.0);
+        result.p99 = Percentile(sorted, 99.0);
+        results_.push_back(std::move(result));
+    }
+
+    const std::vector<BenchResult>& Results() const
+    {
+        return results_;
+    }
+
+private:
+    BenchResult MakeResult(const std::string& name, const BenchParams& params) const
+    {
+        BenchResult result;
+        result.suite = suite_;
+        result.name = name;
+        result.params = params;
+        return result;
+    }
+
+    bool Matches(const std::string& id) const
+    {
+        return options_.filter.empty() || id.find(options_.filter) != std::string::npos;
+    }
+
+    // 运行iterations次，返回总耗时（纳秒）
+    template<typename Operation>
+    static double Measure(Operation& operation, uint64_t iterations)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+            operation();
+        }
+        auto end = std::chrono::steady_clock::now();
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+
+    BenchOptions options_;
+    std::string suite_;
+    std::vector<BenchResult> results_;
+};
+
+// 基准测试套件注册表，每个子系统一个套件
+class BenchRegistry
+{
+public:
+    using SuiteFunc = void (*)(BenchRunner&);
+
+    struct Suite
+    {
+        std::string name;
+        SuiteFunc func;
+    };
+
+    static std::vector<Suite>& Suites()
+    {
+        static std::vector<Suite> suites;
+        return suites;
+    }
+
+    struct Registrar
+    {
+        Registrar(const char* name, SuiteFunc func)
+        {
+            Suites().push_back(Suite{ name, func });
+        }
+    };
+};
+
+// 定义并注册一个基准测试套件
+#define EDITORKIT_BENCH_SUITE(SuiteName) \
+    static void SuiteName##_BenchSuite(BenchRunner& runner); \
+    static BenchRegistry::Registrar SuiteName##_BenchRegistrar(#SuiteName, &SuiteName##_BenchSuite); \
+    static void SuiteName##_BenchSuite(BenchRunner& runner)
@@ -0,0 +1,168 @@
+﻿#include "BenchHarness.h"
+#include "BenchReport.h"
+#include "BenchCompare.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+/* EditorKit 基准测试入口
+*用法: EditorKitBench [--filter 子串] [--samples N] [--min-time-ms 毫秒] [--quick] [--runs N] [--json 文件] [--csv 文件]
+*                      [--baseline 文件] [--tolerance 百分比] [--min-delta-ns 纳秒] [--list]
+*结果始终以表格打印到标准输出；--json/--csv 额外写入机器可读的文件（文件名为"-"时写到标准输出）
+*--runs N 完整运行N次并取各项统计值的中位数；指定 --baseline 时与基线逐项比较，有回归或没有任何用例可对比则返回1，基线无法读取返回2
+*/
+
+static void PrintUsage()
+{
+    std::cout << "用法: EditorKitBench [选项]\n"
+        << "  --filter <子串>      只运行Id包含该子串的用例\n"
+        << "  --samples <N>        每个用例的样本数（默认30）\n"
+        << "  --min-time-ms <ms>   每个样本的最短耗时（默认1）\n"
+        << "  --quick              缩小扫描范围\n"
+        << "  --runs <N>           完整运行N次，结果取中位数（默认1）\n"
+        << "  --json <文件>        输出JSON结果\n"
+        << "  --csv <文件>         输出CSV结果\n"
+        << "  --baseline <文件>    与基线JSON比较，有回归时返回非0\n"
+        << "  --tolerance <百分比> p50相对基线的允许增幅（默认50）\n"
+        << "  --min-delta-ns <ns>  p50增加不超过该值时不算回归（默认5）\n"
+        << "  --list               列出所有套件\n";
+}
+
+template<typename Writer>
+static bool WriteOutput(const std::string& path, const std::vector<BenchResult>& results, Writer writer)
+{
+    if (path == "-")
+    {
+        writer(std::cout, results);
+        return true;
+    }
+    std::ofstream file(path);
+    if (!file)
+    {
+        std::cerr << "无法写入文件: " << path << std::endl;
+        return false;
+    }
+    writer(file, results);
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    BenchOptions options;
+    std::string jsonPath;
+    std::string csvPath;
+    std::string baselinePath;
+    size_t runs = 1;
+    BenchCompare::Thresholds thresholds;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--filter" && hasValue)
+        {
+            options.filter = argv[++i];
+        }
+        else if (arg == "--samples" && hasValue)
+        {
+            options.sampleCount = static_cast<size_t>(std::max(1, std::atoi(argv[++i])));
+        }
+        else if (arg == "--min-time-ms" && hasValue)
+        {
+            options.minSampleTimeNs = std::atof(argv[++i]) * 1e6;
+        }
+        else if (arg == "--quick")
+        {
+            options.quick = true;
+        }
+        else if (arg == "--json" && hasValue)
+        {
+            jsonPath = argv[++i];
+        }
+        else if (arg == "--csv" && hasValue)
+        {
+            csvPath = argv[++i];
+        }
+        else if (arg == "--runs" && hasValue)
+        {
+            runs = static_cast<size_t>(std::max(1, std::atoi(argv[++i])));
+        }
+        else if (arg == "--baseline" && hasValue)
+        {
+            baselinePath = argv[++i];
+        }
+        else if (arg == "--tolerance" && hasValue)
+        {
+            thresholds.tolerancePercent = std::atof(argv[++i]);
+        }
+        else if (arg == "--min-delta-ns" && hasValue)
+        {
+            thresholds.minDeltaNs = std::atof(argv[++i]);
+        }
+        else if (arg == "--list")
+        {
+            for (const auto& suite : BenchRegistry::Suites())
+            {
+                std::cout << suite.name << std::endl;
+            }
+            return 0;
+        }
+        else
+        {
+            PrintUsage();
+            return arg == "--help" || arg == "-h" ? 0 : 1;
+        }
+    }
+
+    // 套件按名称排序，输出顺序不受链接顺序影响
+    std::vector<BenchRegistry::Suite> suites = BenchRegistry::Suites();
+    std::sort(suites.begin(), suites.end(),
+        [](const BenchRegistry::Suite& a, const BenchRegistry::Suite& b) { return a.name < b.name; });
+
+    // 先读取基线，避免运行完整套件后才发现文件有误
+    std::map<std::string, BenchCompare::BaselineEntry> baseline;
+    if (!baselinePath.empty() && !BenchCompare::LoadBaseline(baselinePath, baseline))
+    {
+        std::cerr << "无法读取基线文件: " << baselinePath << std::endl;
+        return 2;
+    }
+
+    std::vector<std::vector<BenchResult>> allRuns;
+    for (size_t run = 0; run < runs; ++run)
+    {
+        BenchRunner runner(options);
+        for (const auto& suite : suites)
+        {
+            runner.SetSuite(suite.name);
+            suite.func(runner);
+        }
+        allRuns.push_back(runner.Results());
+    }
+    std::vector<BenchResult> results = runs > 1 ? BenchCompare::MedianOfRuns(allRuns) : allRuns.front();
+
+    // 表格写到标准错误以免与写到标准输出的JSON/CSV混在一起
+    std::ostream& tableOut = (jsonPath == "-" || csvPath == "-") ? std::cerr : std::cout;
+    BenchReport::WriteTable(tableOut, results);
+
+    bool ok = true;
+    if (!jsonPath.empty())
+    {
+        ok = WriteOutput(jsonPath, results, BenchReport::WriteJson) && ok;
+    }
+    if (!csvPath.empty())
+    {
+        ok = WriteOutput(csvPath, results, BenchReport::WriteCsv) && ok;
+    }
+
+    if (!baselinePath.empty())
+    {
+        tableOut << "\n";
+        BenchCompare::Summary summary = BenchCompare::Compare(tableOut, results, baseline, thresholds, options.filter);
+        ok = summary.regressions == 0 && summary.compared > 0 && ok;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,137 @@
+﻿#pragma once
+
+#include "BenchHarness.h"
+
+#include <cstdio>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// 基准测试结果输出：控制台表格、JSON、CSV
+namespace BenchReport
+{
+    inline std::string FormatNumber(double value)
+    {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.3f", value);
+        return buffer;
+    }
+
+    inline std::string EscapeJson(const std::string& text)
+    {
+        std::string escaped;
+        escaped.reserve(text.size());
+        for (char c : text)
+        {
+            switch (c)
+            {
+            case '"': escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\t': escaped += "\\t"; break;
+            default: escaped += c; break;
+            }
+        }
+        return escaped;
+    }
+
+    // CSV字段含逗号或引号时加引号
+    inline std::string EscapeCsv(const std::string& text)
+    {
+        if (text.find_first_of(",\"\n") == std::string::npos)
+        {
+            return text;
+        }
+        std::string escaped = "\"";
+        for (char c : text)
+        {
+            escaped += c;
+            if (c == '"')
+            {
+                escaped += '"';
+            }
+        }
+        return escaped + "\"";
+    }
+
+    inline std::string FormatParams(const BenchParams& params)
+    {
+        std::string text;
+        for (const auto& param : params)
+        {
+            if (!text.empty())
+            {
+                text += " ";
+            }
+            text += param.first + "=" + std::to_string(param.second);
+        }
+        return text;
+    }
+
+    inline void WriteTable(std::ostream& out, const std::vector<BenchResult>& results)
+    {
+        char line[256];
+        std::snprintf(line, sizeof(line), "%-56s %12s %12s %12s %12s\n", "benchmark", "p50(ns)", "p90(ns)", "p99(ns)", "mean(ns)");
+        out << line;
+        for (const BenchResult& result : results)
+        {
+            std::snprintf(line, sizeof(line), "%-56s %12.2f %12.2f %12.2f %12.2f\n",
+                result.Id().c_str(), result.p50, result.p90, result.p99, result.mean);
+            out << line;
+        }
+    }
+
+    /* JSON格式：
+    *{ "version": 1, "unit": "ns", "benchmarks": [ { "id", "suite", "name", "params": {...}, "iterations", "samples",
+    *  "mean", "min", "max", "p50", "p90", "p99" }, ... ] }
+    */
+    inline void WriteJson(std::ostream& out, const std::vector<BenchResult>& results)
+    {
+        out << "{\n  \"version\": 1,\n  \"unit\": \"ns\",\n  \"benchmarks\": [";
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const BenchResult& result = results[i];
+            out << (i == 0 ? "\n" : ",\n");
+            out << "    {\"id\": \"" << EscapeJson(result.Id()) << "\""
+                << ", \"suite\": \"" << EscapeJson(result.suite) << "\""
+                << ", \"name\": \"" << EscapeJson(result.name) << "\""
+                << ", \"params\": {";
+            for (size_t p = 0; p < result.params.size(); ++p)
+            {
+                out << (p == 0 ? "" : ", ") << "\"" << EscapeJson(result.params[p].first) << "\": " << result.params[p].second;
+            }
+            out << "}"
+                << ", \"iterations\": " << result.iterations
+                << ", \"samples\": " << result.samples.size()
+                << ", \"mean\": " << FormatNumber(result.mean)
+                << ", \"min\": " << FormatNumber(result.min)
+                << ", \"max\": " << FormatNumber(result.max)
+                << ", \"p50\": " << FormatNumber(result.p50)
+                << ", \"p90\": " << FormatNumber(result.p90)
+                << ", \"p99\": " << FormatNumber(result.p99)
+                << "}";
+        }
+        out << "\n  ]\n}\n";
+    }
+
+    // CSV格式：每个用例一行，参数合并为"name=value name=value"一列
+    inline void WriteCsv(std::ostream& out, const std::vector<BenchResult>& results)
+    {
+        out << "id,suite,name,params,iterations,samples,mean_ns,min_ns,max_ns,p50_ns,p90_ns,p99_ns\n";
+        for (const BenchResult& result : results)
+        {
+            out << EscapeCsv(result.Id()) << ","
+                << EscapeCsv(result.suite) << ","
+                << EscapeCsv(result.name) << ","
+                << EscapeCsv(FormatParams(result.params)) << ","
+                << result.iterations << ","
+                << result.samples.size() << ","
+                << FormatNumber(result.mean) << ","
+                << FormatNumber(result.min) << ","
+                << FormatNumber(result.max) << ","
+                << FormatNumber(result.p50) << ","
+                << FormatNumber(result.p90) << ","
+                << FormatNumber(result.p99) << "\n";
+        }
+    }
+}
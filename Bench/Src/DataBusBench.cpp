@@ -0,0 +1,107 @@
+﻿#include "BenchHarness.h"
+
+#include <EditorKit/KDataBus.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct BenchService
+    {
+        int value = 1;
+    };
+
+    // 关闭诊断输出，避免查找失败时的日志影响测量
+    template<typename Bus>
+    void SilenceBus(Bus& bus)
+    {
+        bus.SetLogLevel(DataBusLogLevel::None);
+    }
+}
+
+// DataBus：按数据项数量扫描键查找，对比句柄、按类型服务槽位、作用域链与并发读取
+EDITORKIT_BENCH_SUITE(DataBus)
+{
+    for (int64_t entries : runner.Sweep({ 16, 1024, 65536 }, { 16, 1024 }))
+    {
+        DataBus<std::string> bus;
+        SilenceBus(bus);
+        std::vector<int> values(static_cast<size_t>(entries), 1);
+        std::vector<std::string> keys;
+        for (int64_t i = 0; i < entries; ++i)
+        {
+            keys.push_back("data." + std::to_string(i));
+            bus.RegisterData(keys.back(), &values[static_cast<size_t>(i)]);
+        }
+
+        size_t index = 0;
+        runner.Run("GetDataSafe", { { "entries", entries } }, [&]()
+            {
+                DoNotOptimize(bus.GetDataSafe<int>(keys[index]));
+                index = index + 1 == keys.size() ? 0 : index + 1;
+            });
+
+        auto handle = bus.GetHandle<int>(keys[0]);
+        runner.Run("HandleGet", { { "entries", entries } }, [&]()
+            {
+                DoNotOptimize(handle.Get());
+            });
+    }
+
+    {
+        DataBus<std::string> bus;
+        BenchService service;
+        bus.Register(&service);
+        runner.Run("TypedServiceGet", {}, [&]()
+            {
+                DoNotOptimize(bus.Get<BenchService>());
+            });
+    }
+
+    // 键注册在根作用域，从最深的子作用域查找
+    for (int64_t depth : runner.Sweep({ 1, 4, 16 }, { 1, 4 }))
+    {
+        std::vector<std::unique_ptr<DataBus<std::string>>> scopes;
+        scopes.push_back(std::make_unique<DataBus<std::string>>());
+        SilenceBus(*scopes.back());
+        int value = 1;
+        scopes.back()->RegisterData("scoped", &value);
+        for (int64_t i = 0; i < depth; ++i)
+        {
+            scopes.push_back(std::make_unique<DataBus<std::string>>(scopes.back().get()));
+        }
+
+        DataBus<std::string>& leaf = *scopes.back();
+        const std::string key = "scoped";
+        runner.Run("ScopedLookup", { { "depth", depth } }, [&]()
+            {
+                DoNotOptimize(leaf.GetDataSafe<int>(key));
+            });
+    }
+
+    {
+        ConcurrentDataBus<std::string> bus;
+        int value = 1;
+        bus.RegisterData("concurrent", &value);
+        const std::string key = "concurrent";
+        runner.Run("ConcurrentGetDataSafe", {}, [&]()
+            {
+                DoNotOptimize(bus.GetDataSafe<int>(key));
+            });
+    }
+
+    {
+        DataBus<std::string> bus;
+        SilenceBus(bus);
+        bus.RegisterTripleBuffer<int>("frame");
+        const std::string key = "frame";
+        int frame = 0;
+        runner.Run("TripleBufferPublishAcquire", {}, [&]()
+            {
+                bus.Publish(key, ++frame);
+                DoNotOptimize(*bus.AcquireLatest<int>(key));
+            });
+    }
+}
@@ -0,0 +1,62 @@
+﻿#include "BenchHarness.h"
+
+#include <EditorKit/KEventBus.h>
+#include <EditorKit/StaticString.h>
+
+#include <string>
+
+// EventBus：按订阅者数量扫描多播/单播发布，以及冻结键集合后的发布
+EDITORKIT_BENCH_SUITE(EventBus)
+{
+    for (int64_t subscribers : runner.Sweep({ 1, 16, 256, 1024 }, { 1, 16 }))
+    {
+        EventBus<std::string> bus;
+        int64_t counter = 0;
+        for (int64_t i = 0; i < subscribers; ++i)
+        {
+            bus.Subscribe("publish", [&counter](int value) { counter += value; });
+        }
+        // 其他事件使键查找不至于退化为单元素映射表
+        for (int i = 0; i < 64; ++i)
+        {
+            bus.Subscribe("other_" + std::to_string(i), [](int) {});
+        }
+
+        const std::string key = "publish";
+        runner.Run("Publish", { { "subscribers", subscribers } }, [&]()
+            {
+                DoNotOptimize(bus.Publish(key, 1).success);
+            });
+
+        bus.Freeze();
+        runner.Run("PublishFrozen", { { "subscribers", subscribers } }, [&]()
+            {
+                DoNotOptimize(bus.Publish(key, 1).success);
+            });
+        DoNotOptimize(counter);
+    }
+
+    {
+        EventBus<std::string> bus;
+        int64_t counter = 0;
+        bus.SubscribeUnicast("unicast", [&counter](int value) { counter += value; });
+        const std::string key = "unicast";
+        runner.Run("PublishUnicast", {}, [&]()
+            {
+                DoNotOptimize(bus.PublishUnicast(key, 1).success);
+            });
+        DoNotOptimize(counter);
+    }
+
+    {
+        EventBus<StaticString> bus;
+        int64_t counter = 0;
+        const StaticString key("static_publish");
+        bus.Subscribe(key, [&counter](int value) { counter += value; });
+        runner.Run("PublishStaticStringKey", {}, [&]()
+            {
+                DoNotOptimize(bus.Publish(key, 1).success);
+            });
+        DoNotOptimize(counter);
+    }
+}
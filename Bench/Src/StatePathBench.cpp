@@ -0,0 +1,91 @@
+﻿#include "BenchHarness.h"
+
+#include <functional>
+#include <EditorKit/StatePath.h>
+
+#include <string>
+
+// 生成深度为depth的路径：n0/n1/.../n{depth-1}
+static std::string MakePath(int64_t depth)
+{
+    std::string path;
+    for (int64_t i = 0; i < depth; ++i)
+    {
+        path += (i == 0 ? "n" : "/n") + std::to_string(i);
+    }
+    return path;
+}
+
+// StatePath：按路径深度与兄弟节点数量扫描get/set，按监听器数量扫描事件分发
+EDITORKIT_BENCH_SUITE(StatePath)
+{
+    for (int64_t depth : runner.Sweep({ 1, 4, 16 }, { 1, 4 }))
+    {
+        for (int64_t siblings : runner.Sweep({ 1, 64, 1024 }, { 1, 64 }))
+        {
+            BenchParams params = { { "depth", depth }, { "siblings", siblings } };
+            if (!runner.Enabled("GetInt", params) && !runner.Enabled("SetInt", params))
+            {
+                continue;
+            }
+
+            StatePath system;
+            system.setEventEnabled(false);
+            const std::string path = MakePath(depth);
+            const std::string parent = depth > 1 ? path.substr(0, path.rfind('/') + 1) : std::string();
+            for (int64_t i = 0; i < siblings; ++i)
+            {
+                system.setInt(parent + "sibling" + std::to_string(i), static_cast<int>(i));
+            }
+            system.setInt(path, 1);
+
+            runner.Run("GetInt", params, [&]()
+                {
+                    int value = 0;
+                    DoNotOptimize(system.getInt(path, value));
+                    DoNotOptimize(value);
+                });
+
+            int next = 0;
+            runner.Run("SetInt", params, [&]()
+                {
+                    system.setInt(path, ++next);
+                });
+        }
+    }
+
+    // 监听器挂在目标节点各级祖先的ALL_CHILDREN上，覆盖findListeners的路径前缀匹配
+    for (int64_t listeners : runner.Sweep({ 0, 16, 256 }, { 0, 16 }))
+    {
+        BenchParams params = { { "listeners", listeners } };
+        if (!runner.Enabled("ListenerDispatch", params))
+        {
+            continue;
+        }
+
+        StatePath system;
+        const int64_t depth = 4;
+        const std::string path = MakePath(depth);
+        system.setInt(path, 0);
+
+        int64_t callbacks = 0;
+        for (int64_t i = 0; i < listeners; ++i)
+        {
+            system.addEventListener(MakePath(1 + i % depth), ListenGranularity::ALL_CHILDREN, EventType::UPDATE,
+                [&callbacks](const PathEvent&) { ++callbacks; });
+        }
+        // 不相关子树上的监听器，不应被匹配
+        for (int64_t i = 0; i < listeners; ++i)
+        {
+            system.addEventListener("unrelated/" + std::to_string(i), ListenGranularity::NODE, EventType::UPDATE,
+                [&callbacks](const PathEvent&) { ++callbacks; });
+        }
+
+        int next = 0;
+        runner.Run("ListenerDispatch", params, [&]()
+            {
+                system.setInt(path, ++next);
+            });
+        DoNotOptimize(callbacks);
+    }
+}
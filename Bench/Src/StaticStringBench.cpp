@@ -0,0 +1,174 @@
+﻿#include "BenchHarness.h"
+
+#include <EditorKit/StaticString.h>
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    /* 常驻的一组工作线程：RunRound让每个线程执行一次任务并等待全部完成
+    *线程在构造时创建、析构时回收，计时只包含唤醒与任务本身，不包含线程创建
+    */
+    class WorkerGang
+    {
+    public:
+        WorkerGang(size_t threadCount, std::function<void(size_t)> task) : task_(std::move(task))
+        {
+            for (size_t i = 0; i < threadCount; ++i)
+            {
+                threads_.emplace_back([this, i]() { WorkerLoop(i); });
+            }
+        }
+
+        ~WorkerGang()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            start_.notify_all();
+            for (auto& thread : threads_)
+            {
+                thread.join();
+            }
+        }
+
+        WorkerGang(const WorkerGang&) = delete;
+        WorkerGang& operator=(const WorkerGang&) = delete;
+
+        void RunRound()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            pending_ = threads_.size();
+            ++round_;
+            start_.notify_all();
+            finished_.wait(lock, [this]() { return pending_ == 0; });
+        }
+
+    private:
+        void WorkerLoop(size_t index)
+        {
+            uint64_t seenRound = 0;
+            while (true)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    start_.wait(lock, [&]() { return stop_ || round_ != seenRound; });
+                    if (stop_)
+                    {
+                        return;
+                    }
+                    seenRound = round_;
+                }
+
+                task_(index);
+
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (--pending_ == 0)
+                {
+                    finished_.notify_one();
+                }
+            }
+        }
+
+        std::function<void(size_t)> task_;
+        std::vector<std::thread> threads_;
+        std::mutex mutex_;
+        std::condition_variable start_;
+        std::condition_variable finished_;
+        uint64_t round_ = 0;
+        size_t pending_ = 0;
+        bool stop_ = false;
+    };
+}
+
+// StaticString：按不同字符串数量扫描驻留（覆盖线程缓存命中与未命中），按线程数扫描并发驻留与读取，以及字面量与比较
+EDITORKIT_BENCH_SUITE(StaticString)
+{
+    for (int64_t distinct : runner.Sweep({ 1, 64, 4096 }, { 1, 64 }))
+    {
+        std::vector<std::string> texts;
+        for (int64_t i = 0; i < distinct; ++i)
+        {
+            texts.push_back("bench.intern." + std::to_string(i));
+            StaticString warm(texts.back());
+        }
+
+        size_t index = 0;
+        runner.Run("InternExisting", { { "distinct", distinct } }, [&]()
+            {
+                StaticString value(texts[index]);
+                DoNotOptimize(value);
+                index = index + 1 == texts.size() ? 0 : index + 1;
+            });
+    }
+
+    // 多个线程同时驻留并读取同一组字符串：不同字符串数量超过线程缓存容量，大部分查找落到共享的字符串池
+    // 每次迭代为一轮，每个线程各完成OpsPerThread次驻留+读取；线程数增加时理想情况下单轮耗时不变
+    {
+        constexpr size_t DistinctTexts = 1024;
+        constexpr size_t OpsPerThread = 256;
+        std::vector<std::string> texts;
+        for (size_t i = 0; i < DistinctTexts; ++i)
+        {
+            texts.push_back("bench.concurrent." + std::to_string(i));
+            StaticString warm(texts.back());
+        }
+
+        for (int64_t threads : runner.Sweep({ 1, 2, 4, 8 }, { 1, 2, 4 }))
+        {
+            BenchParams params{ { "threads", threads } };
+            if (!runner.Enabled("ConcurrentInternRead", params))
+            {
+                continue;
+            }
+
+            WorkerGang gang(static_cast<size_t>(threads), [&](size_t worker)
+                {
+                    // 各线程从不同位置开始，以互质步长遍历，避免所有线程同时访问同一个字符串
+                    size_t index = worker * 97 % DistinctTexts;
+                    size_t length = 0;
+                    for (size_t i = 0; i < OpsPerThread; ++i)
+                    {
+                        StaticString value(texts[index]);
+                        length += value.view().size();
+                        index = (index + 31) % DistinctTexts;
+                    }
+                    DoNotOptimize(length);
+                });
+            runner.Run("ConcurrentInternRead", params, [&]()
+                {
+                    gang.RunRound();
+                });
+        }
+    }
+
+    runner.Run("InternLiteral", {}, []()
+        {
+            StaticString value("bench.literal"_ss);
+            DoNotOptimize(value);
+        });
+
+    runner.Run("StaticStringMacro", {}, []()
+        {
+            DoNotOptimize(STATIC_STRING("bench.macro"));
+        });
+
+    {
+        const StaticString a("bench.compare.a");
+        const StaticString b("bench.compare.b");
+        runner.Run("Compare", {}, [&]()
+            {
+                DoNotOptimize(a == b);
+            });
+        runner.Run("ViewAccess", {}, [&]()
+            {
+                DoNotOptimize(a.view().size());
+            });
+    }
+}
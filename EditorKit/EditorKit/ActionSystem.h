@@ -13,6 +13,7 @@
 #include <algorithm>
 #include <variant>
 #include "Type_Check.h"
+#include "FrozenKeyIndex.h"
 
 /*
 *   ע⣡
@@ -636,6 +637,50 @@ private:
     ActionStorage actions_;
     std::unordered_map<ActionHandle<KeyType>, KeyType, typename ActionHandle<KeyType>::Hash> handleToActionMap_;
 
+    // ״̬µĲλָactions_Ԫصָ루Ԫصַrehash󱣳ֲ䣩
+    // üһִʱǩƥ䵽ĴǩͬٴֱִӸ
+    using ActionEntry = typename ActionStorage::mapped_type;
+    struct FrozenAction
+    {
+        ActionEntry* entry = nullptr;
+        const void* signature = nullptr;
+        IActionProcessorWrapper* processor = nullptr;
+    };
+    FrozenKeyIndex<KeyType, Hash, KeyEqual> frozenIndex_;
+    std::vector<FrozenAction> frozenActions_;
+    bool frozen_ = false;
+
+    // ǩʶÿͶӦΨһĵַȽʱ蹹ַ
+    template<typename... Args>
+    static const void* ArgsSignature()
+    {
+        static const char signature = 0;
+        return &signature;
+    }
+
+    // ĳİװɾãλлƥ
+    void ResetFrozenMatch(const KeyType& actionKey)
+    {
+        if (frozen_)
+        {
+            size_t slot = frozenIndex_.Find(actionKey);
+            if (slot != FrozenKeyIndex<KeyType, Hash, KeyEqual>::npos)
+            {
+                frozenActions_[slot].signature = nullptr;
+                frozenActions_[slot].processor = nullptr;
+            }
+        }
+    }
+
+    // µĶʱã¼ڶἯУԶⶳ
+    void UnfreezeIfNewKey(const KeyType& actionKey)
+    {
+        if (frozen_ && frozenIndex_.Find(actionKey) == FrozenKeyIndex<KeyType, Hash, KeyEqual>::npos)
+        {
+            Unfreeze();
+        }
+    }
+
     // ȫֶ
     using GlobalCompletionListener = std::function<void(const KeyType&, const ActionResult&)>;
     struct GlobalListenerInfo
@@ -1128,6 +1173,7 @@ private:
             std::string argTypes = type_check::get_template_args_info<Args...>();
             size_t argCount = sizeof...(Args);
             
+            UnfreezeIfNewKey(actionKey);
             auto& wrappers = actions_[actionKey];
             
             // ǷѴͬ͵İװ
@@ -1147,6 +1193,7 @@ private:
             auto newWrapper = std::make_unique<ActionProcessorWrapper<Args...>>();
             auto* ptr = newWrapper.get();
             wrappers.push_back(std::move(newWrapper));
+            ResetFrozenMatch(actionKey);
             return ptr;
         }
         else
@@ -1166,6 +1213,7 @@ private:
         if (it == actions_.end())
         {
             // ڣµ
+            UnfreezeIfNewKey(actionKey);
             auto wrapper = std::make_unique<ActionProcessorWrapper<Args...>>();
             auto* ptr = wrapper.get();
             actions_[actionKey] = std::move(wrapper);
@@ -1191,24 +1239,48 @@ private:
         return existing;
     }
 
-    // ƥĴģʽµִУ
+    // ƥĴʱһ̽ⶨλλǩϴͬͱȽ
     template<typename... Args>
     IActionProcessorWrapper* FindMatchingProcessor(const KeyType& actionKey)
+    {
+        if (frozen_)
+        {
+            size_t slot = frozenIndex_.Find(actionKey);
+            if (slot == FrozenKeyIndex<KeyType, Hash, KeyEqual>::npos)
+            {
+                return nullptr;
+            }
+            FrozenAction& frozen = frozenActions_[slot];
+            const void* signature = ArgsSignature<Args...>();
+            if (frozen.signature != signature)
+            {
+                frozen.processor = MatchProcessor<Args...>(*frozen.entry);
+                frozen.signature = signature;
+            }
+            return frozen.processor;
+        }
+
+        auto it = actions_.find(actionKey);
+        return it != actions_.end() ? MatchProcessor<Args...>(it->second) : nullptr;
+    }
+
+    // ڶĿаͲҴ
+    template<typename... Args>
+    IActionProcessorWrapper* MatchProcessor(ActionEntry& entry)
     {
         if constexpr (!AllowOverload)
         {
-            // أֱӲ
-            auto it = actions_.find(actionKey);
-            if (it == actions_.end())
+            // أֱӼ
+            if (!entry)
             {
                 return nullptr;
             }
             std::string argTypes = type_check::get_template_args_info<Args...>();
             size_t argCount = sizeof...(Args);
 
-            if (it->second->CheckArgsMatch(argTypes, argCount))
+            if (entry->CheckArgsMatch(argTypes, argCount))
             {
-                return it->second.get();
+                return entry.get();
             }
             else
             {
@@ -1219,16 +1291,10 @@ private:
         else
         {
             // أвƥĴ
-            auto it = actions_.find(actionKey);
-            if (it == actions_.end())
-            {
-                return nullptr;
-            }
-
             std::string argTypes = type_check::get_template_args_info<Args...>();
             size_t argCount = sizeof...(Args);
             
-            for (auto& wrapper : it->second)
+            for (auto& wrapper : entry)
             {
                 if (wrapper->CheckArgsMatch(argTypes, argCount))
                 {
@@ -1496,6 +1562,7 @@ public:
                     auto newEnd = std::remove_if(actionIt->second.begin(), actionIt->second.end(),
                         [](const auto& w) { return w->GetTotalHandlers() == 0; });
                     actionIt->second.erase(newEnd, actionIt->second.end());
+                    ResetFrozenMatch(actionKey);
                     
                     handleToActionMap_.erase(it);
                     return true;
@@ -1595,9 +1662,50 @@ public:
         globalCompletionListeners_.clear();
     }
 
+    // ᵱǰϣΪ乹СϣִʱԵ̽Ҵϣң
+    // λǩƥظִʱٹͱȽϲַ
+    // ֮¶ĴԶⶳʧܣڹϣֵͬļʱfalseδ
+    bool Freeze()
+    {
+        Unfreeze();
+        std::vector<KeyType> keys;
+        keys.reserve(actions_.size());
+        for (const auto& entry : actions_)
+        {
+            keys.push_back(entry.first);
+        }
+        if (!frozenIndex_.Build(keys))
+        {
+            return false;
+        }
+
+        frozenActions_.resize(frozenIndex_.Size());
+        for (size_t slot = 0; slot < frozenIndex_.Size(); ++slot)
+        {
+            frozenActions_[slot].entry = &actions_.find(frozenIndex_.KeyAt(slot))->second;
+        }
+        frozen_ = true;
+        return true;
+    }
+
+    // ⶳָϣ
+    void Unfreeze()
+    {
+        frozen_ = false;
+        frozenIndex_.Clear();
+        frozenActions_.clear();
+    }
+
+    // Ƿڶ״̬
+    bool IsFrozen() const
+    {
+        return frozen_;
+    }
+
     // ռ
     void Clear()
     {
+        Unfreeze();
         actions_.clear();
         handleToActionMap_.clear();
         globalCompletionListeners_.clear();  // 
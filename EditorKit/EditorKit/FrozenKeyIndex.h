@@ -0,0 +1,176 @@
+﻿#pragma once
+
+//----------------------------------------------------------冻结键集合索引（最小完美哈希）-------------------------------------------------
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/* 冻结键集合的最小完美哈希索引（hash-and-displace）
+*将一组固定的键一一映射到[0, N)中的槽位，查找只需一次整数混合、一次乘法、一次位移表读取和一次键比较
+*适用于启动后键集合不再变化的场景（EventBus/ActionSystem的Freeze），键集合变化后需重新Build
+*模板参数[0]KeyType-键类型
+*模板参数[1]Hash-键值类型的哈希函数，不同键的哈希值必须互不相同，否则Build失败
+*模板参数[2]KeyEqual-键值类型判等函数
+*/
+template<typename KeyType, typename Hash = std::hash<KeyType>, typename KeyEqual = std::equal_to<KeyType>>
+class FrozenKeyIndex
+{
+public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    // 构建索引；存在哈希值相同的键或位移搜索失败时返回false，索引保持为空
+    bool Build(const std::vector<KeyType>& keys)
+    {
+        Clear();
+        const size_t keyCount = keys.size();
+        if (keyCount == 0)
+        {
+            return true;
+        }
+
+        std::vector<uint64_t> hashes(keyCount);
+        for (size_t i = 0; i < keyCount; ++i)
+        {
+            hashes[i] = Mix(static_cast<uint64_t>(Hash()(keys[i])));
+        }
+
+        // 混合函数是双射，混合后相同即原哈希相同，此类键无法区分
+        std::vector<uint64_t> sortedHashes = hashes;
+        std::sort(sortedHashes.begin(), sortedHashes.end());
+        if (std::adjacent_find(sortedHashes.begin(), sortedHashes.end()) != sortedHashes.end())
+        {
+            return false;
+        }
+
+        // 按哈希高位分桶，平均每桶BucketLoad个键
+        const size_t bucketCount = (keyCount + BucketLoad - 1) / BucketLoad;
+        std::vector<std::vector<size_t>> buckets(bucketCount);
+        for (size_t i = 0; i < keyCount; ++i)
+        {
+            buckets[BucketOf(hashes[i], bucketCount)].push_back(i);
+        }
+
+        // 大桶优先放置，此时空闲槽位多，更容易找到位移值
+        std::vector<size_t> order(bucketCount);
+        for (size_t i = 0; i < bucketCount; ++i)
+        {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b)
+            {
+                return buckets[a].size() > buckets[b].size();
+            });
+
+        std::vector<uint64_t> displacements(bucketCount, 0);
+        std::vector<size_t> slotToKey(keyCount, npos);
+        std::vector<size_t> candidate;
+        for (size_t bucket : order)
+        {
+            const auto& members = buckets[bucket];
+            if (members.empty())
+            {
+                break;
+            }
+
+            bool placed = false;
+            for (uint32_t seed = 0; seed < MaxSeed && !placed; ++seed)
+            {
+                const uint64_t displacement = Displacement(seed);
+                candidate.clear();
+                placed = true;
+                for (size_t keyIndex : members)
+                {
+                    size_t slot = SlotOf(hashes[keyIndex], displacement, keyCount);
+                    if (slotToKey[slot] != npos || std::find(candidate.begin(), candidate.end(), slot) != candidate.end())
+                    {
+                        placed = false;
+                        break;
+                    }
+                    candidate.push_back(slot);
+                }
+                if (placed)
+                {
+                    for (size_t i = 0; i < members.size(); ++i)
+                    {
+                        slotToKey[candidate[i]] = members[i];
+                    }
+                    displacements[bucket] = displacement;
+                }
+            }
+            if (!placed)
+            {
+                return false;
+            }
+        }
+
+        keys_.reserve(keyCount);
+        for (size_t slot = 0; slot < keyCount; ++slot)
+        {
+            keys_.push_back(keys[slotToKey[slot]]);
+        }
+        displacements_ = std::move(displacements);
+        return true;
+    }
+
+    // 单次探测查找，返回槽位；不在集合中返回npos
+    size_t Find(const KeyType& key) const
+    {
+        if (keys_.empty())
+        {
+            return npos;
+        }
+        uint64_t hash = Mix(static_cast<uint64_t>(Hash()(key)));
+        size_t slot = SlotOf(hash, displacements_[BucketOf(hash, displacements_.size())], keys_.size());
+        return KeyEqual()(keys_[slot], key) ? slot : npos;
+    }
+
+    const KeyType& KeyAt(size_t slot) const { return keys_[slot]; }
+    size_t Size() const { return keys_.size(); }
+    bool Empty() const { return keys_.empty(); }
+
+    void Clear()
+    {
+        keys_.clear();
+        displacements_.clear();
+    }
+
+private:
+    static constexpr size_t BucketLoad = 4;          // 平均每桶键数
+    static constexpr uint32_t MaxSeed = 1u << 22;    // 单个桶的位移搜索上限
+
+    // splitmix64终结函数，将StaticString这类连续整数哈希打散
+    static uint64_t Mix(uint64_t x)
+    {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ull;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebull;
+        x ^= x >> 31;
+        return x;
+    }
+
+    // 位移值在构建时由种子展开并按桶保存，查找时直接使用
+    static uint64_t Displacement(uint32_t seed)
+    {
+        return (static_cast<uint64_t>(seed) + 1) * 0x9e3779b97f4a7c15ull;
+    }
+
+    // 取高32位映射到[0, range)，避免取模
+    static size_t BucketOf(uint64_t hash, size_t range)
+    {
+        return static_cast<size_t>(((hash >> 32) * static_cast<uint64_t>(range)) >> 32);
+    }
+
+    // 键哈希已充分混合，异或位移值后乘一次即可使同桶的键在不同位移值下落点各异
+    static size_t SlotOf(uint64_t hash, uint64_t displacement, size_t range)
+    {
+        uint64_t x = (hash ^ displacement) * 0x94d049bb133111ebull;
+        return static_cast<size_t>(((x >> 32) * static_cast<uint64_t>(range)) >> 32);
+    }
+
+    std::vector<KeyType> keys_;     // 按槽位排列的键，用于确认命中
+    std::vector<uint64_t> displacements_;   // 每个桶的位移值
+};
@@ -10,6 +10,31 @@
 #include <iostream>
 #include <sstream>
 #include <cstdio>
+#include <cstdint>
+#include <deque>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <new>
+#include <type_traits>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+// Ϣ
+enum class DataBusLogLevel
+{
+    Debug = 0,      // Ϣ
+    Info = 1,       // ɹע/ע/յȳϢ
+    Warning = 2,    // ʧܡעڵļ
+    Error = 3,      // עʧܡͲƥ
+    None = 4        // رȫ
+};
+
+// ϼ𣬵ڴ˼ϴ벻ᱻ루0=Debug ... 4=None
+#ifndef DATABUS_MIN_LOG_LEVEL
+#define DATABUS_MIN_LOG_LEVEL 0
+#endif
 
 // ߽ṹ
 struct DataBusResult
@@ -70,14 +95,194 @@ struct DataItemInfo
     std::type_index typeIndex; // Ϣ
     std::string typeName; // 
     std::string description; // Ϣ
+    size_t slotIndex; // λ
+    uint64_t version = 0; // һעMarkChangedʱİ汾
+    void (*destroy)(void*) = nullptr; // DataBusеĶEmplaceⲿΪ
+    size_t ownedSize = 0; // жĴС
+    size_t ownedAlign = 0; // жĶ
+
+    DataItemInfo(void* ptr, const std::type_index& index, const std::string& name, const std::string& desc = "", size_t slot = 0)
+        : dataPtr(ptr), typeIndex(index), typeName(name), description(desc), slotIndex(slot)
+    {
+    }
+};
+
+/* DataBusжڴ
+*С󣨲MaxSmallSizeҶ벻Granularity16ֽȴڴ˳䣬עĶڴڣʱѺ
+*ͷŵС󰴴Сּ֮ͬã򳬶󵥶
+*/
+class DataBusArena
+{
+public:
+    static constexpr size_t Granularity = 16;
+    static constexpr size_t MaxSmallSize = 256;
+    static constexpr size_t BlockSize = 16 * 1024;
+
+    DataBusArena() = default;
+    DataBusArena(const DataBusArena&) = delete;
+    DataBusArena& operator=(const DataBusArena&) = delete;
+
+    ~DataBusArena()
+    {
+        for (void* block : blocks_)
+        {
+            ::operator delete(block);
+        }
+    }
+
+    void* Allocate(size_t size, size_t alignment)
+    {
+        if (!IsSmall(size, alignment))
+        {
+            return ::operator new(size, std::align_val_t(alignment));
+        }
+
+        size_t sizeClass = SizeClass(size);
+        std::vector<void*>& freeList = freeLists_[sizeClass];
+        if (!freeList.empty())
+        {
+            void* memory = freeList.back();
+            freeList.pop_back();
+            return memory;
+        }
+
+        size_t rounded = (sizeClass + 1) * Granularity;
+        if (rounded > remaining_)
+        {
+            // ::operator new صĵַٰ __STDCPP_DEFAULT_NEW_ALIGNMENT__С16
+            cursor_ = static_cast<unsigned char*>(::operator new(BlockSize));
+            blocks_.push_back(cursor_);
+            remaining_ = BlockSize;
+        }
+        void* memory = cursor_;
+        cursor_ += rounded;
+        remaining_ -= rounded;
+        return memory;
+    }
+
+    void Deallocate(void* memory, size_t size, size_t alignment)
+    {
+        if (!IsSmall(size, alignment))
+        {
+            ::operator delete(memory, std::align_val_t(alignment));
+            return;
+        }
+        freeLists_[SizeClass(size)].push_back(memory);
+    }
+
+private:
+    static bool IsSmall(size_t size, size_t alignment)
+    {
+        return size <= MaxSmallSize && alignment <= Granularity;
+    }
+
+    static size_t SizeClass(size_t size)
+    {
+        return size == 0 ? 0 : (size - 1) / Granularity;
+    }
+
+    std::vector<void*> blocks_;
+    unsigned char* cursor_ = nullptr;
+    size_t remaining_ = 0;
+    std::vector<void*> freeLists_[MaxSmallSize / Granularity];
+};
+
+/* 
+*ڵ̶߳֡߳ȡһ֡ݣͳϢԻбȣ
+*дԼռĺ󻺳ύ߻ȡύǰ壻˫ֻһԭӽ޵ȴ
+*߿ĳһύݣдһ֡δʱȡм֡ᱻ֡
+*/
+template<typename T>
+class TripleBuffer
+{
+public:
+    explicit TripleBuffer(const T& initial = T())
+        : buffers_{ { initial }, { initial }, { initial } }
+    {
+    }
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // ߣȡǰ󻺳壬ɸѷдCommit
+    T& WriteBuffer()
+    {
+        return buffers_[back_].value;
+    }
+
+    // ߣύ󻺳壬ʹΪһ֡
+    void Commit()
+    {
+        uint8_t previous = shared_.exchange(static_cast<uint8_t>(back_ | DirtyBit), std::memory_order_acq_rel);
+        back_ = previous & IndexMask;
+    }
+
+    // ߣд벢ύһ֡
+    template<typename U>
+    void Publish(U&& value)
+    {
+        WriteBuffer() = std::forward<U>(value);
+        Commit();
+    }
+
+    // ߣȡύһ֡û֡ʱһλȡ
+    const T& AcquireLatest()
+    {
+        if (shared_.load(std::memory_order_relaxed) & DirtyBit)
+        {
+            uint8_t previous = shared_.exchange(front_, std::memory_order_acq_rel);
+            front_ = previous & IndexMask;
+        }
+        return buffers_[front_].value;
+    }
 
-    DataItemInfo(void* ptr, const std::type_index& index, const std::string& name, const std::string& desc = "")
-        : dataPtr(ptr), typeIndex(index), typeName(name), description(desc)
+    // ߣǷδȡ֡
+    bool HasNewData() const
     {
+        return (shared_.load(std::memory_order_relaxed) & DirtyBit) != 0;
     }
+
+private:
+    static constexpr uint8_t IndexMask = 3;
+    static constexpr uint8_t DirtyBit = 4;
+
+    // ռУ߻
+    struct alignas(64) Buffer
+    {
+        T value;
+    };
+
+    Buffer buffers_[3];
+    alignas(64) std::atomic<uint8_t> shared_{ 1 }; // м仺֡
+    alignas(64) uint8_t back_ = 0; // ߷
+    alignas(64) uint8_t front_ = 2; // ߷
+};
+
+// λַȶעʱָ벢ʹѷŵľʧЧ
+struct DataSlot
+{
+    void* dataPtr = nullptr;
+    uint32_t generation = 0;
 };
 
 // ϵͳ - ֧Զͺ͹ϣ
+/* עķλ
+*ÿ״ʹʱһΨһDataBusʵͬһʵԼķָ
+*/
+class DataBusTypeSlot
+{
+public:
+    template<typename T>
+    static size_t Index()
+    {
+        static const size_t index = nextIndex_.fetch_add(1, std::memory_order_relaxed);
+        return index;
+    }
+
+private:
+    static inline std::atomic<size_t> nextIndex_{ 0 };
+};
+
 template<typename KeyType = std::string, typename Hash = std::hash<KeyType>>
 class DataBus
 {
@@ -92,13 +297,239 @@ private:
     // 洢ӳ
     std::unordered_map<KeyType, DataItemInfo, Hash> dataMap_;
 
-    // ص
-    std::function<void(const char*)> errorHandler_;
+    // λdeque׷ʱԪصַ䣩вλ
+    std::deque<DataSlot> slots_;
+    std::vector<size_t> freeSlots_;
+
+    /* 㼶
+    *ʱȲδҵٻ˵ҵĽУظֻһιϣ̽
+    *δҵĽ棬СеHasDataȶ̽
+    *һһע/ע/ʱִ仯ս
+    *򲻵ڸٺʹãĲһ»棬ڶ߳ͬʱ
+    *PublishAcquireLatest⣺ǲ棬ֻȡϵӳ
+    */
+    struct ResolvedEntry
+    {
+        DataBus* owner = nullptr;     // ڵ
+        DataItemInfo* info = nullptr; // δҵʱΪ
+    };
+
+    DataBus* parent_ = nullptr;
+    std::shared_ptr<uint64_t> scopeGeneration_;
+    mutable std::unordered_map<KeyType, ResolvedEntry, Hash> resolveCache_;
+    mutable uint64_t cacheGeneration_ = 0;
+
+    // ɾʹĽʧЧ
+    void BumpScopeGeneration()
+    {
+        ++*scopeGeneration_;
+    }
+
+    // д
+    ResolvedEntry ResolveUncached(const KeyType& key) const
+    {
+        for (DataBus* scope = const_cast<DataBus*>(this); scope; scope = scope->parent_)
+        {
+            auto it = scope->dataMap_.find(key);
+            if (it != scope->dataMap_.end())
+            {
+                return ResolvedEntry{ scope, &it->second };
+            }
+        }
+        return ResolvedEntry{};
+    }
+
+    // λ˵
+    ResolvedEntry Resolve(const KeyType& key) const
+    {
+        if (!parent_)
+        {
+            return ResolveUncached(key);
+        }
+
+        if (cacheGeneration_ != *scopeGeneration_)
+        {
+            if (!resolveCache_.empty())
+            {
+                resolveCache_.clear();
+            }
+            cacheGeneration_ = *scopeGeneration_;
+        }
+
+        auto cached = resolveCache_.find(key);
+        if (cached != resolveCache_.end())
+        {
+            return cached->second;
+        }
+
+        ResolvedEntry resolved = ResolveUncached(key);
+        if (resolved.info)
+        {
+            resolveCache_.emplace(key, resolved);
+        }
+        return resolved;
+    }
+
+    // עķDataBusTypeSlotΪ±
+    std::vector<void*> services_;
+
+    // EmplaceĶڵڴ
+    DataBusArena arena_;
+
+    template<typename T>
+    static void DestroyObject(void* object)
+    {
+        static_cast<T*>(object)->~T();
+    }
+
+    // ӳƳãͷDataBusеĶ
+    void DestroyOwned(void* dataPtr, void (*destroy)(void*), size_t size, size_t alignment)
+    {
+        if (destroy)
+        {
+            destroy(dataPtr);
+            arena_.Deallocate(dataPtr, size, alignment);
+        }
+    }
+
+    // 汾ţÿעMarkChangedversionIndex_汾ChangedSinceö
+    uint64_t currentVersion_ = 0;
+    std::map<uint64_t, KeyType> versionIndex_;
+
+    // ۲
+    using ChangeObserver = std::function<void(const KeyType&, uint64_t)>;
+    struct ObserverInfo
+    {
+        uint64_t id;
+        bool observeAll;
+        KeyType key;
+        std::shared_ptr<ChangeObserver> callback;
+    };
+    std::vector<ObserverInfo> observers_;
+    uint64_t nextObserverId_ = 1;
+
+    // °汾Ų֪ͨ۲ߣ۲߿ڻصעkeyɵ÷жȡdataMap_
+    void BumpVersion(const KeyType& key, DataItemInfo& info)
+    {
+        if (info.version != 0)
+        {
+            versionIndex_.erase(info.version);
+        }
+        info.version = ++currentVersion_;
+        versionIndex_.emplace(info.version, key);
+        NotifyObservers(key, info.version);
+    }
+
+    // ֪ͨ۲üĹ۲ߣversionΪ0ʾѱע
+    void NotifyObservers(const KeyType& key, uint64_t version)
+    {
+        if (observers_.empty())
+        {
+            return;
+        }
+        // ƻص۲ڻصɾ۲߻
+        std::vector<std::shared_ptr<ChangeObserver>> callbacks;
+        for (const auto& observer : observers_)
+        {
+            if (observer.observeAll || observer.key == key)
+            {
+                callbacks.push_back(observer.callback);
+            }
+        }
+        for (const auto& callback : callbacks)
+        {
+            (*callback)(key, version);
+        }
+    }
+
+    // ֪ͨ۲ߣжϢһд룬ҲʧЧ
+    // ۲ڻصжȡעüʱĶ
+    // destroyǿʱDataBusУӳ֮ǰ׳쳣ڴͷţ֮
+    template<typename T>
+    void InsertData(const KeyType& key, T* dataPtr, const std::string& description, void (*destroy)(void*))
+    {
+        typename std::unordered_map<KeyType, DataItemInfo, Hash>::iterator inserted;
+        size_t slotIndex = 0;
+        bool slotAcquired = false;
+        try
+        {
+            slotIndex = AcquireSlot(dataPtr);
+            slotAcquired = true;
+            DataItemInfo info(dataPtr, std::type_index(typeid(T)), GetTypeName<T>(), description, slotIndex);
+            if (destroy)
+            {
+                info.destroy = destroy;
+                info.ownedSize = sizeof(T);
+                info.ownedAlign = alignof(T);
+            }
+            inserted = dataMap_.emplace(key, std::move(info)).first;
+        }
+        catch (...)
+        {
+            if (slotAcquired)
+            {
+                ReleaseSlot(slotIndex);
+            }
+            DestroyOwned(dataPtr, destroy, sizeof(T), alignof(T));
+            throw;
+        }
+        BumpScopeGeneration();
+
+        Log<DataBusLogLevel::Info>([&]()
+            {
+                std::stringstream ss;
+                ss << "ɹע - : " << key << ", : " << GetTypeName<T>()
+                    << (description.empty() ? "" : ", : " + description);
+                return ss.str();
+            });
+
+        BumpVersion(key, inserted->second);
+    }
+
+    size_t AcquireSlot(void* dataPtr)
+    {
+        size_t index;
+        if (!freeSlots_.empty())
+        {
+            index = freeSlots_.back();
+            freeSlots_.pop_back();
+        }
+        else
+        {
+            index = slots_.size();
+            slots_.emplace_back();
+        }
+        slots_[index].dataPtr = dataPtr;
+        return index;
+    }
+
+    void ReleaseSlot(size_t index)
+    {
+        slots_[index].dataPtr = nullptr;
+        slots_[index].generation++;
+        freeSlots_.push_back(index);
+    }
+
+    // Ϣصʱֵ
+    std::function<void(DataBusLogLevel, const char*)> logHandler_;
+    DataBusLogLevel logLevel_ = DataBusLogLevel::Warning;
+
+    static const char* GetLogLevelName(DataBusLogLevel level)
+    {
+        switch (level)
+        {
+        case DataBusLogLevel::Debug: return "Debug";
+        case DataBusLogLevel::Info: return "Info";
+        case DataBusLogLevel::Warning: return "Warning";
+        case DataBusLogLevel::Error: return "Error";
+        default: return "None";
+        }
+    }
 
-    // Ĭϴprintf
-    static void DefaultErrorHandler(const char* message)
+    // Ĭϴprintf
+    static void DefaultLogHandler(DataBusLogLevel level, const char* message)
     {
-        printf("DataBus Error: %s\n", message);
+        printf("DataBus %s: %s\n", GetLogLevelName(level), message);
     }
 
     // ȡ͵Ŀɶ
@@ -108,29 +539,142 @@ private:
         return std::string(typeid(T).name());
     }
 
-    // ڲ󱨸溯
-    void ReportError(const std::string& message) const
+    // ڲϺڱڻʱʱformatκθʽ
+    template<DataBusLogLevel Level, typename Formatter>
+    void Log(Formatter&& format) const
     {
-        if (errorHandler_)
+        if constexpr (static_cast<int>(Level) >= DATABUS_MIN_LOG_LEVEL && Level != DataBusLogLevel::None)
         {
-            errorHandler_(message.c_str());
+            if (logHandler_ && IsLogEnabled(Level))
+            {
+                std::string message = format();
+                logHandler_(Level, message.c_str());
+            }
         }
     }
 
+    // Ҳͣʧʱ¼Warning/ErrorϣDataBusResult
+    template<typename T>
+    ResolvedEntry FindTyped(const KeyType& key)
+    {
+        return CheckType<T>(key, Resolve(key));
+    }
+
+    template<typename T>
+    ResolvedEntry CheckType(const KeyType& key, ResolvedEntry resolved) const
+    {
+        if (!resolved.info)
+        {
+            Log<DataBusLogLevel::Warning>([&]() { return "δҵӦ: " + KeyToString(key); });
+            return ResolvedEntry{};
+        }
+        if (resolved.info->typeIndex != std::type_index(typeid(T)))
+        {
+            Log<DataBusLogLevel::Error>([&]()
+                {
+                    return "Ͳƥ - : " + KeyToString(key) + ", ע: " + resolved.info->typeName
+                        + ", : " + GetTypeName<T>();
+                });
+            return ResolvedEntry{};
+        }
+        return resolved;
+    }
+
 public:
-    DataBus() : errorHandler_(DefaultErrorHandler)
+    /* ͻݾ
+    *ͨGetHandleȡȡʱɼͼ飻֮ȡֻȽϴȡָ룬ϣͱȽ
+    *Ӧע߱գʧЧGet()nullptrDataBusٺʹ
+    */
+    template<typename T>
+    class Handle
     {
+    public:
+        Handle() = default;
+
+        T* Get() const
+        {
+            return (slot_ && slot_->generation == generation_) ? static_cast<T*>(slot_->dataPtr) : nullptr;
+        }
+
+        bool IsValid() const { return Get() != nullptr; }
+        explicit operator bool() const { return IsValid(); }
+        T* operator->() const { return Get(); }
+        T& operator*() const { return *Get(); }
+
+    private:
+        friend class DataBus;
+        Handle(const DataSlot* slot, uint32_t generation) : slot_(slot), generation_(generation) {}
+
+        const DataSlot* slot_ = nullptr;
+        uint32_t generation_ = 0;
+    };
+
+    DataBus() : scopeGeneration_(std::make_shared<uint64_t>(0)), logHandler_(DefaultLogHandler)
+    {
+    }
+
+    // ɸƣEmplaceĶĸָ붼߼乲
+    DataBus(const DataBus&) = delete;
+    DataBus& operator=(const DataBus&) = delete;
+
+    // δעļ˵ңעͬǸ
+    explicit DataBus(DataBus* parent)
+        : parent_(parent)
+        , scopeGeneration_(parent ? parent->scopeGeneration_ : std::make_shared<uint64_t>(0))
+        , cacheGeneration_(*scopeGeneration_)
+        , logHandler_(parent ? parent->logHandler_ : std::function<void(DataBusLogLevel, const char*)>(DefaultLogHandler))
+        , logLevel_(parent ? parent->logLevel_ : DataBusLogLevel::Warning)
+    {
+    }
+
+    // ȡ򣨸򷵻nullptr
+    DataBus* GetParent() const
+    {
+        return parent_;
     }
 
     virtual ~DataBus()
     {
+        observers_.clear(); // ʱ֪ͨ۲
         Clear();
     }
 
-    // ô
+    // ôüϢּ
     void SetErrorHandler(std::function<void(const char*)> handler)
     {
-        errorHandler_ = std::move(handler);
+        if (!handler)
+        {
+            logHandler_ = nullptr;
+            return;
+        }
+        logHandler_ = [handler = std::move(handler)](DataBusLogLevel, const char* message)
+            {
+                handler(message);
+            };
+    }
+
+    // ôϴ
+    void SetLogHandler(std::function<void(DataBusLogLevel, const char*)> handler)
+    {
+        logHandler_ = std::move(handler);
+    }
+
+    // ʱϼֵĬWarningֵϲᱻʽ
+    void SetLogLevel(DataBusLogLevel level)
+    {
+        logLevel_ = level;
+    }
+
+    DataBusLogLevel GetLogLevel() const
+    {
+        return logLevel_;
+    }
+
+    // ָǷᱻ
+    bool IsLogEnabled(DataBusLogLevel level) const
+    {
+        return static_cast<int>(level) >= DATABUS_MIN_LOG_LEVEL && level != DataBusLogLevel::None
+            && static_cast<int>(level) >= static_cast<int>(logLevel_);
     }
 
     // עָ
@@ -140,7 +684,7 @@ public:
         if (dataPtr == nullptr)
         {
             std::string error = "עָΪ: " + KeyToString(key); 
-            ReportError(error);
+            Log<DataBusLogLevel::Error>([&]() { return error; });
             return DataBusResult(false, nullptr, error);
         }
 
@@ -150,37 +694,55 @@ public:
             std::stringstream ss;
             ss << " '" << KeyToString(key) << "' Ѵڣǰע: " << it->second.typeName; 
             std::string error = ss.str();
-            ReportError(error);
+            Log<DataBusLogLevel::Error>([&]() { return error; });
             return DataBusResult(false, nullptr, error);
         }
 
-        // Ϣ
-        DataItemInfo info(dataPtr, std::type_index(typeid(T)), GetTypeName<T>(), description);
+        InsertData(key, dataPtr, description, nullptr);
+        return DataBusResult(true, dataPtr, "עɹ");
+    }
 
-        // עᵽӳ
-        dataMap_.emplace(key, std::move(info));
+    // DataBusеڴо͵عעᣬעʱԶ
+    template<typename T, typename... Args>
+    DataBusResult Emplace(const KeyType& key, Args&&... args)
+    {
+        auto it = dataMap_.find(key);
+        if (it != dataMap_.end())
+        {
+            std::string error = " '" + KeyToString(key) + "' Ѵڣǰע: " + it->second.typeName;
+            Log<DataBusLogLevel::Error>([&]() { return error; });
+            return DataBusResult(false, nullptr, error);
+        }
 
-        std::stringstream ss;
-        ss << "ɹע - : " << key << ", : " << GetTypeName<T>()
-            << (description.empty() ? "" : ", : " + description);
-        ReportError(ss.str());
+        void* memory = arena_.Allocate(sizeof(T), alignof(T));
+        T* object;
+        try
+        {
+            object = new (memory) T(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            arena_.Deallocate(memory, sizeof(T), alignof(T));
+            throw;
+        }
 
-        return DataBusResult(true, dataPtr, "עɹ");
+        InsertData(key, object, "", &DestroyObject<T>);
+        return DataBusResult(true, object, "עɹ");
     }
 
     // ȡָ루ͼ飩
     template<typename T>
     DataBusResult GetData(const KeyType& key)
     {
-        auto it = dataMap_.find(key);
-        if (it == dataMap_.end())
+        DataItemInfo* found = Resolve(key).info;
+        if (!found)
         {
             std::string error = "δҵӦ: " + KeyToString(key);  // ޸
-            ReportError(error);
+            Log<DataBusLogLevel::Warning>([&]() { return error; });
             return DataBusResult(false, nullptr, error);
         }
 
-        DataItemInfo& info = it->second;
+        DataItemInfo& info = *found;
         std::string requestedType = GetTypeName<T>();
 
         // ʱͼ
@@ -191,7 +753,7 @@ public:
                 << ", ע: " << info.typeName
                 << ", : " << requestedType;
             std::string error = ss.str();
-            ReportError(error);
+            Log<DataBusLogLevel::Error>([&]() { return error; });
 
             DataBusResult result(false, nullptr, error);
             result.registeredType = info.typeName;
@@ -205,40 +767,137 @@ public:
         return result;
     }
 
-    // ȫȡݣͲƥ䷵nullptr
+    /* עDataBusеصָ/߻
+    *עɺPublishAcquireLatestɷֱ̲߳߳ãͬã߲½棩
+    *ڼ䲻߳עᡢעͨӿڲҸ
+    */
     template<typename T>
-    T* GetDataSafe(const KeyType& key)
+    TripleBuffer<T>* RegisterTripleBuffer(const KeyType& key, const T& initial = T())
     {
-        DataBusResult result = GetData<T>(key);
-        if (result.success)
+        DataBusResult result = Emplace<TripleBuffer<T>>(key, initial);
+        return result.success ? static_cast<TripleBuffer<T>*>(result.dataPtr) : nullptr;
+    }
+
+    // ߣһ֡ڻͲƥʱfalse
+    template<typename T>
+    bool Publish(const KeyType& key, T&& value)
+    {
+        using Buffer = TripleBuffer<std::decay_t<T>>;
+        DataItemInfo* info = CheckType<Buffer>(key, ResolveUncached(key)).info;
+        Buffer* buffer = info ? static_cast<Buffer*>(info->dataPtr) : nullptr;
+        if (!buffer)
         {
-            return static_cast<T*>(result.dataPtr);
+            return false;
+        }
+        buffer->Publish(std::forward<T>(value));
+        return true;
+    }
+
+    // ߣȡµһ֡ڻͲƥʱnullptr
+    template<typename T>
+    const T* AcquireLatest(const KeyType& key)
+    {
+        DataItemInfo* info = CheckType<TripleBuffer<T>>(key, ResolveUncached(key)).info;
+        return info ? &static_cast<TripleBuffer<T>*>(info->dataPtr)->AcquireLatest() : nullptr;
+    }
+
+    /* עᵥÿһ밴עݻ
+    *ȡʱֻ͵Ĳλ飬ϣͱȽϣnullptrͬע
+    *δעķ˵ȡעͬͷɸǸķ
+    *Clear()ֻհעݣӰעķҪʱClearServices()
+    */
+    template<typename T>
+    void Register(T* service)
+    {
+        size_t index = DataBusTypeSlot::Index<T>();
+        if (index >= services_.size())
+        {
+            services_.resize(index + 1, nullptr);
+        }
+        services_[index] = service;
+    }
+
+    // עעķ
+    template<typename T>
+    void Unregister()
+    {
+        size_t index = DataBusTypeSlot::Index<T>();
+        if (index < services_.size())
+        {
+            services_[index] = nullptr;
+        }
+    }
+
+    // עаעķ
+    void ClearServices()
+    {
+        services_.clear();
+    }
+
+    // ȡעķϾδעʱnullptr
+    template<typename T>
+    T* Get() const
+    {
+        size_t index = DataBusTypeSlot::Index<T>();
+        for (const DataBus* scope = this; scope; scope = scope->parent_)
+        {
+            if (index < scope->services_.size() && scope->services_[index])
+            {
+                return static_cast<T*>(scope->services_[index]);
+            }
         }
         return nullptr;
     }
 
-    // Ƿ
+    // ȡͻڻͲƥʱЧ
+    template<typename T>
+    Handle<T> GetHandle(const KeyType& key)
+    {
+        ResolvedEntry resolved = FindTyped<T>(key);
+        if (!resolved.info)
+        {
+            return Handle<T>();
+        }
+        const DataSlot& slot = resolved.owner->slots_[resolved.info->slotIndex];
+        return Handle<T>(&slot, slot.generation);
+    }
+
+    // ȫȡݣͲƥ䷵nullptrDataBusResult
+    template<typename T>
+    T* GetDataSafe(const KeyType& key)
+    {
+        DataItemInfo* info = FindTyped<T>(key).info;
+        return info ? static_cast<T*>(info->dataPtr) : nullptr;
+    }
+
+    // Ƿڣе
     bool HasData(const KeyType& key) const
+    {
+        return Resolve(key).info != nullptr;
+    }
+
+    // Ƿעڵǰ򣨲˵
+    bool HasLocalData(const KeyType& key) const
     {
         return dataMap_.find(key) != dataMap_.end();
     }
 
     std::string GetDataType(const KeyType& key) const
     {
-        auto it = dataMap_.find(key);
-        if (it != dataMap_.end())
+        DataItemInfo* info = Resolve(key).info;
+        if (info)
         {
-            return it->second.typeName;
+            return info->typeName;
         }
         return "δҵ: " + KeyToString(key);  // ޸
     }
 
     std::string GetDataDescription(const KeyType& key) const
     {
-        auto it = dataMap_.find(key);
-        if (it != dataMap_.end())
+        DataItemInfo* info = Resolve(key).info;
+        if (info)
         {
-            return it->second.description;
+            return info->description;
         }
         return "δҵ: " + KeyToString(key);  // ޸
     }
@@ -249,29 +908,55 @@ public:
         auto it = dataMap_.find(key);
         if (it != dataMap_.end())
         {
-            std::stringstream ss;
-            ss << "ע - : " << key << ", : " << it->second.typeName;
-            ReportError(ss.str());
+            Log<DataBusLogLevel::Info>([&]()
+                {
+                    std::stringstream ss;
+                    ss << "ע - : " << key << ", : " << it->second.typeName;
+                    return ss.str();
+                });
 
+            ReleaseSlot(it->second.slotIndex);
+            versionIndex_.erase(it->second.version);
+            DataItemInfo info = std::move(it->second);
             dataMap_.erase(it);
+            BumpScopeGeneration();
+            DestroyOwned(info.dataPtr, info.destroy, info.ownedSize, info.ownedAlign);
+            NotifyObservers(key, 0);
             return true;
         }
 
-        std::string error = "עʧܣδҵ: " + KeyToString(key);  
-        ReportError(error);
+        Log<DataBusLogLevel::Warning>([&]() { return "עʧܣδҵ: " + KeyToString(key); });
         return false;
     }
 
-    // 
+    // аעݣעķ񱣳ֲ
     void Clear()
     {
         if (!dataMap_.empty())
         {
-            std::stringstream ss;
-            ss << "ߣ " << dataMap_.size() << " ";
-            ReportError(ss.str());
+            Log<DataBusLogLevel::Info>([&]()
+                {
+                    std::stringstream ss;
+                    ss << "ߣ " << dataMap_.size() << " ";
+                    return ss.str();
+                });
 
+            for (const auto& entry : dataMap_)
+            {
+                ReleaseSlot(entry.second.slotIndex);
+            }
+            versionIndex_.clear();
+            auto removed = std::move(dataMap_);
             dataMap_.clear();
+            BumpScopeGeneration();
+            for (auto& entry : removed)
+            {
+                DestroyOwned(entry.second.dataPtr, entry.second.destroy, entry.second.ownedSize, entry.second.ownedAlign);
+            }
+            for (const auto& entry : removed)
+            {
+                NotifyObservers(entry.first, 0);
+            }
         }
     }
 
@@ -281,6 +966,74 @@ public:
         return dataMap_.size();
     }
 
+    // ѱ޸ģ汾Ų֪ͨ۲ߣʱfalse
+    bool MarkChanged(const KeyType& key)
+    {
+        auto it = dataMap_.find(key);
+        if (it == dataMap_.end())
+        {
+            Log<DataBusLogLevel::Warning>([&]() { return "Ǳʧܣδҵ: " + KeyToString(key); });
+            return false;
+        }
+        BumpVersion(key, it->second);
+        return true;
+    }
+
+    // ǰ汾ţһαİ汾ޱʱΪ0
+    uint64_t GetVersion() const
+    {
+        return currentVersion_;
+    }
+
+    // ȡİ汾ţʱ0
+    uint64_t GetDataVersion(const KeyType& key) const
+    {
+        auto it = dataMap_.find(key);
+        return it != dataMap_.end() ? it->second.version : 0;
+    }
+
+    // öٰ汾Ŵversion汾Ӿɵ£Ըð汾ע򱻱Ǳ
+    // עڽ
+    std::vector<KeyType> ChangedSince(uint64_t version) const
+    {
+        std::vector<KeyType> keys;
+        for (auto it = versionIndex_.upper_bound(version); it != versionIndex_.end(); ++it)
+        {
+            keys.push_back(it->second);
+        }
+        return keys;
+    }
+
+    // ۲ָıעMarkChangedصΪ°汾ţع۲ID
+    // עʱصİ汾Ϊ0ʱƳеĶ
+    uint64_t AddObserver(const KeyType& key, ChangeObserver callback)
+    {
+        uint64_t id = nextObserverId_++;
+        observers_.push_back({ id, false, key, std::make_shared<ChangeObserver>(std::move(callback)) });
+        return id;
+    }
+
+    // ۲мı
+    uint64_t AddGlobalObserver(ChangeObserver callback)
+    {
+        uint64_t id = nextObserverId_++;
+        observers_.push_back({ id, true, KeyType(), std::make_shared<ChangeObserver>(std::move(callback)) });
+        return id;
+    }
+
+    // Ƴ۲
+    bool RemoveObserver(uint64_t observerId)
+    {
+        auto it = std::find_if(observers_.begin(), observers_.end(),
+            [observerId](const ObserverInfo& observer) { return observer.id == observerId; });
+        if (it == observers_.end())
+        {
+            return false;
+        }
+        observers_.erase(it);
+        return true;
+    }
+
     // ȡݵͳϢ
     std::string GetStatistics() const
     {
@@ -320,12 +1073,203 @@ public:
     template<typename T>
     bool CheckDataType(const KeyType& key) const
     {
-        auto it = dataMap_.find(key);
-        if (it == dataMap_.end())
+        DataItemInfo* info = Resolve(key).info;
+        if (!info)
         {
             return false;
         }
 
-        return it->second.typeIndex == std::type_index(typeid(T));
+        return info->typeIndex == std::type_index(typeid(T));
+    }
+};
+
+/* 
+*дٳȾ̶̡߳߳ȡݣUI߳ע/ע
+*ȡͨRCUʽʲɱݱֻԭӼָȡӲҷɢԵĻ߳չ
+*дڻ¸Ƶǰݱ޸ģ±ȴڶȡɱĶ˳ͷžɱ
+*д뿪ȣʺע/עƵԶڶȡĳ
+*/
+template<typename KeyType = std::string, typename Hash = std::hash<KeyType>>
+class ConcurrentDataBus
+{
+    using Table = std::unordered_map<KeyType, DataItemInfo, Hash>;
+
+    static constexpr size_t ReaderSlotCount = 64;
+
+    // ߼ԪżΪ飻ÿλռУ̵ͬ߳Ķȡ
+    struct alignas(64) ReaderSlot
+    {
+        std::atomic<uint64_t> counts[2] = {};
+    };
+
+    // ȡڼ䱣ݱͷ
+    class ReadGuard
+    {
+    public:
+        explicit ReadGuard(const ConcurrentDataBus& bus)
+            : slot_(bus.readerSlots_[GetThreadSlotIndex()])
+        {
+            // ȷϼԪδ䣺ȡԪ֮дл˼Ԫдߵȴһ
+            // һдߵȴǡòһ飬ζȡıܱͷţ˳
+            for (;;)
+            {
+                epoch_ = bus.epoch_.load(std::memory_order_seq_cst);
+                slot_.counts[epoch_].fetch_add(1, std::memory_order_seq_cst);
+                if (bus.epoch_.load(std::memory_order_seq_cst) == epoch_)
+                {
+                    break;
+                }
+                slot_.counts[epoch_].fetch_sub(1, std::memory_order_release);
+            }
+            table_ = bus.table_.load(std::memory_order_seq_cst);
+        }
+
+        ~ReadGuard()
+        {
+            slot_.counts[epoch_].fetch_sub(1, std::memory_order_release);
+        }
+
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+        const Table& GetTable() const { return *table_; }
+
+    private:
+        ReaderSlot& slot_;
+        unsigned epoch_;
+        const Table* table_;
+    };
+
+    static size_t GetThreadSlotIndex()
+    {
+        static std::atomic<size_t> nextIndex{ 0 };
+        thread_local size_t index = nextIndex.fetch_add(1, std::memory_order_relaxed) % ReaderSlotCount;
+        return index;
+    }
+
+    mutable ReaderSlot readerSlots_[ReaderSlotCount];
+    std::atomic<unsigned> epoch_{ 0 };
+    std::atomic<const Table*> table_;
+    std::mutex writeMutex_;
+
+    // ±ȴɱĶȫ˳ͷžɱ÷writeMutex_
+    void Publish(const Table* newTable)
+    {
+        const Table* oldTable = table_.exchange(newTable, std::memory_order_seq_cst);
+
+        // лԪ¶߼һֻ٣ȴ㼴
+        unsigned oldEpoch = epoch_.load(std::memory_order_relaxed);
+        epoch_.store(oldEpoch ^ 1u, std::memory_order_seq_cst);
+        for (auto& slot : readerSlots_)
+        {
+            while (slot.counts[oldEpoch].load(std::memory_order_seq_cst) != 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+        delete oldTable;
+    }
+
+public:
+    ConcurrentDataBus() : table_(new Table())
+    {
+    }
+
+    ~ConcurrentDataBus()
+    {
+        delete table_.load(std::memory_order_relaxed);
+    }
+
+    ConcurrentDataBus(const ConcurrentDataBus&) = delete;
+    ConcurrentDataBus& operator=(const ConcurrentDataBus&) = delete;
+
+    // עָ룻ָΪջѴʱfalse
+    template<typename T>
+    bool RegisterData(const KeyType& key, T* dataPtr, const std::string& description = "")
+    {
+        if (dataPtr == nullptr)
+        {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        const Table* current = table_.load(std::memory_order_relaxed);
+        if (current->find(key) != current->end())
+        {
+            return false;
+        }
+        Table* newTable = new Table(*current);
+        newTable->emplace(key, DataItemInfo(dataPtr, std::type_index(typeid(T)), typeid(T).name(), description));
+        Publish(newTable);
+        return true;
+    }
+
+    // ע
+    bool UnregisterData(const KeyType& key)
+    {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        const Table* current = table_.load(std::memory_order_relaxed);
+        if (current->find(key) == current->end())
+        {
+            return false;
+        }
+        Table* newTable = new Table(*current);
+        newTable->erase(key);
+        Publish(newTable);
+        return true;
+    }
+
+    // 
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        Publish(new Table());
+    }
+
+    // ȫȡݣڻͲƥ䷵nullptr
+    template<typename T>
+    T* GetDataSafe(const KeyType& key) const
+    {
+        ReadGuard guard(*this);
+        const Table& table = guard.GetTable();
+        auto it = table.find(key);
+        if (it == table.end() || it->second.typeIndex != std::type_index(typeid(T)))
+        {
+            return nullptr;
+        }
+        return static_cast<T*>(it->second.dataPtr);
+    }
+
+    // Ƿ
+    bool HasData(const KeyType& key) const
+    {
+        ReadGuard guard(*this);
+        return guard.GetTable().count(key) != 0;
+    }
+
+    // Ƿƥ
+    template<typename T>
+    bool CheckDataType(const KeyType& key) const
+    {
+        return GetDataSafe<T>(key) != nullptr;
+    }
+
+    // ȡ
+    size_t GetDataCount() const
+    {
+        ReadGuard guard(*this);
+        return guard.GetTable().size();
+    }
+
+    // ȡмĿ
+    std::vector<KeyType> GetAllKeys() const
+    {
+        ReadGuard guard(*this);
+        std::vector<KeyType> keys;
+        keys.reserve(guard.GetTable().size());
+        for (const auto& pair : guard.GetTable())
+        {
+            keys.push_back(pair.first);
+        }
+        return keys;
     }
 };
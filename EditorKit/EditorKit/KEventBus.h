@@ -16,6 +16,7 @@
 #include <random>
 #include <iomanip>
 #include "Type_Check.h"
+#include "FrozenKeyIndex.h"
 
 //！！！重要说明！！！
 /*
@@ -361,6 +362,16 @@ public:
     // 获取事件的订阅模式
     SubscriptionMode GetEventMode(const EventKeyType& eventName) const;
 
+    // 冻结当前事件键集合：为其构建最小完美哈希，发布时以单次探测的数组查找代替哈希表查找
+    // 之后订阅新的事件键会自动解冻；构建失败（如存在哈希值相同的键）时返回false并保持未冻结
+    bool Freeze();
+
+    // 解冻，恢复哈希表查找
+    void Unfreeze();
+
+    // 是否处于冻结状态
+    bool IsFrozen() const { return frozen_; }
+
     ~EventBus();
 
 private:
@@ -606,6 +617,7 @@ private:
         // 注册Token到事件名称的映射
         tokenToEventNameMap_[token] = eventName;
 
+        RefreshFrozenEntry(eventName);
         return token;
     }
 
@@ -627,48 +639,49 @@ private:
         if (mode == SubscriptionMode::Unicast)
         {
             // 单播发布
-            auto it = unicastEventHandlers_.find(eventName);
-            if (it == unicastEventHandlers_.end())
+            IEventFunction* handler = FindUnicastHandler(eventName);
+            if (!handler)
             {
                 result.success = false;
                 result.errorMessage = "单播事件未找到";
                 return result;
             }
 
-            //auto typedHandler = dynamic_cast<EventFunctionImpl<Args...>*>(it->second.get());
+            //auto typedHandler = dynamic_cast<EventFunctionImpl<Args...>*>(handler);
             //if (!typedHandler)
             // 检查参数数量和类型名称是否匹配
-            if (it->second->GetArgCount() != sizeof...(Args) ||
-                it->second->GetArgTypes() != type_check::get_template_args_info<std::decay_t<Args>...>())
+            if (handler->GetArgCount() != sizeof...(Args) ||
+                handler->GetArgTypes() != type_check::get_template_args_info<std::decay_t<Args>...>())
             {
-                result.AddFailure(it->second->GetArgTypes());
+                result.AddFailure(handler->GetArgTypes());
                 result.errorMessage = "单播事件参数类型不匹配";
                 return result;
             }
 
             // 使用完美转发执行
-            if (it->second->ExecuteWithForward(argPointers))
+            if (handler->ExecuteWithForward(argPointers))
             {
                 result.AddSuccess();
 
                 // 检查是否是一次性事件
-                auto onceIt = unicastOnceEventHandlers_.find(eventName);
-                if (onceIt != unicastOnceEventHandlers_.end())
+                if (EventID* onceToken = FindUnicastOnceToken(eventName))
                 {
-                    Unsubscribe(onceIt->second);
+                    Unsubscribe(EventID(*onceToken));
                 }
             }
             else
             {
-                result.AddFailure(it->second->GetArgTypes());
+                result.AddFailure(handler->GetArgTypes());
                 result.errorMessage = "单播事件执行失败";
             }
         }
         else
         {
             // 多播发布
-            auto handlersIt = multicastEventHandlers_.find(eventName);
-            if (handlersIt == multicastEventHandlers_.end())
+            // 一次性Token列表随处理器一起查找，避免每个订阅者都做一次键查找
+            const std::vector<EventID>* onceTokens = nullptr;
+            auto* handlers = FindMulticastHandlers(eventName, onceTokens);
+            if (!handlers)
             {
                 result.success = false;
                 result.errorMessage = "多播事件未找到";
@@ -680,7 +693,7 @@ private:
             bool hasAnySuccessfulExecution = false;
 
             // 遍历所有订阅者
-            for (const auto& handler : handlersIt->second)
+            for (const auto& handler : *handlers)
             {
                 // 检查参数数量和类型名称是否匹配
                 //auto typedHandler = dynamic_cast<EventFunctionImpl<Args...>*>(handler.get());//使用dynamic_cast进行参数验证性能只有使用typeid进行参数验证的1/30（release）
@@ -699,12 +712,10 @@ private:
                     hasAnySuccessfulExecution = true;
 
                     // 检查是否是一次性事件
-                    auto onceIt = multicastOnceEventHandlers_.find(eventName);
-                    if (onceIt != multicastOnceEventHandlers_.end())
+                    if (onceTokens)
                     {
-                        const auto& onceTokens = onceIt->second;
-                        if (std::find(onceTokens.begin(), onceTokens.end(),
-                            handler->GetToken()) != onceTokens.end())
+                        if (std::find(onceTokens->begin(), onceTokens->end(),
+                            handler->GetToken()) != onceTokens->end())
                         {
                             tokensToRemove.push_back(handler->GetToken());
                         }
@@ -744,6 +755,89 @@ private:
         return result;
     }
 
+    // 冻结状态下每个事件键对应的各处理器容器（指向哈希表中的元素，元素地址在rehash后保持不变）
+    struct FrozenEntry
+    {
+        std::vector<std::unique_ptr<IEventFunction>>* multicast = nullptr;
+        std::unique_ptr<IEventFunction>* unicast = nullptr;
+        std::vector<EventID>* multicastOnce = nullptr;
+        EventID* unicastOnce = nullptr;
+    };
+
+    template <typename Map>
+    static auto FindInMap(Map& map, const EventKeyType& eventName) -> decltype(&map.begin()->second)
+    {
+        auto it = map.find(eventName);
+        return it != map.end() ? &it->second : nullptr;
+    }
+
+    // 冻结时查完美哈希表，否则查哈希表
+    FrozenEntry* FindFrozenEntry(const EventKeyType& eventName)
+    {
+        size_t slot = frozenIndex_.Find(eventName);
+        return slot != FrozenKeyIndex<EventKeyType, Hash>::npos ? &frozenEntries_[slot] : nullptr;
+    }
+
+    IEventFunction* FindUnicastHandler(const EventKeyType& eventName)
+    {
+        std::unique_ptr<IEventFunction>* handler;
+        if (frozen_)
+        {
+            FrozenEntry* entry = FindFrozenEntry(eventName);
+            handler = entry ? entry->unicast : nullptr;
+        }
+        else
+        {
+            handler = FindInMap(unicastEventHandlers_, eventName);
+        }
+        return handler ? handler->get() : nullptr;
+    }
+
+    // 单播处理器执行后才查找一次性Token，处理器可能在回调中修改订阅
+    EventID* FindUnicastOnceToken(const EventKeyType& eventName)
+    {
+        if (frozen_)
+        {
+            FrozenEntry* entry = FindFrozenEntry(eventName);
+            return entry ? entry->unicastOnce : nullptr;
+        }
+        return FindInMap(unicastOnceEventHandlers_, eventName);
+    }
+
+    // 查找多播处理器及其一次性Token列表：冻结时一次探测同时取得两者，未冻结时分别查两张哈希表
+    std::vector<std::unique_ptr<IEventFunction>>* FindMulticastHandlers(const EventKeyType& eventName,
+        const std::vector<EventID>*& onceTokens)
+    {
+        if (frozen_)
+        {
+            FrozenEntry* entry = FindFrozenEntry(eventName);
+            onceTokens = entry ? entry->multicastOnce : nullptr;
+            return entry ? entry->multicast : nullptr;
+        }
+        auto* handlers = FindInMap(multicastEventHandlers_, eventName);
+        onceTokens = handlers ? FindInMap(multicastOnceEventHandlers_, eventName) : nullptr;
+        return handlers;
+    }
+
+    // 某个事件键的处理器容器增删后调用：同步冻结表中的指针；新事件键不在冻结集合中，自动解冻
+    void RefreshFrozenEntry(const EventKeyType& eventName)
+    {
+        if (!frozen_)
+        {
+            return;
+        }
+        FrozenEntry* entry = FindFrozenEntry(eventName);
+        if (!entry)
+        {
+            Unfreeze();
+            return;
+        }
+        entry->multicast = FindInMap(multicastEventHandlers_, eventName);
+        entry->unicast = FindInMap(unicastEventHandlers_, eventName);
+        entry->multicastOnce = FindInMap(multicastOnceEventHandlers_, eventName);
+        entry->unicastOnce = FindInMap(unicastOnceEventHandlers_, eventName);
+    }
+
     // 准备参数指针数组（从KEventBus_Ref借鉴）
     template<typename Tuple, size_t... Is>
     void PrepareArgPointers(void* pointers[], Tuple&& tuple, std::index_sequence<Is...>)
@@ -766,6 +860,11 @@ private:
 
     // Token到事件名称映射（使用UUID的哈希函数）
     std::unordered_map<EventID, EventKeyType, EventID::Hash> tokenToEventNameMap_;
+
+    // 冻结状态：完美哈希索引及按槽位排列的处理器容器指针
+    FrozenKeyIndex<EventKeyType, Hash> frozenIndex_;
+    std::vector<FrozenEntry> frozenEntries_;
+    bool frozen_ = false;
 };
 
 // 取消订阅实现
@@ -834,12 +933,54 @@ bool EventBus<EventKeyType, Hash>::Unsubscribe(const EventID& token)
         unicastOnceEventHandlers_.erase(unicastOnceIt);
     }
 
+    RefreshFrozenEntry(eventName);
+
     // 移除Token映射
     tokenToEventNameMap_.erase(it);
 
     return true;
 }
 
+template<typename EventKeyType, typename Hash>
+bool EventBus<EventKeyType, Hash>::Freeze()
+{
+    std::vector<EventKeyType> keys;
+    keys.reserve(multicastEventHandlers_.size() + unicastEventHandlers_.size());
+    for (const auto& entry : multicastEventHandlers_)
+    {
+        keys.push_back(entry.first);
+    }
+    for (const auto& entry : unicastEventHandlers_)
+    {
+        if (multicastEventHandlers_.find(entry.first) == multicastEventHandlers_.end())
+        {
+            keys.push_back(entry.first);
+        }
+    }
+
+    Unfreeze();
+    if (!frozenIndex_.Build(keys))
+    {
+        return false;
+    }
+
+    frozenEntries_.assign(frozenIndex_.Size(), FrozenEntry());
+    frozen_ = true;
+    for (size_t slot = 0; slot < frozenIndex_.Size(); ++slot)
+    {
+        RefreshFrozenEntry(frozenIndex_.KeyAt(slot));
+    }
+    return true;
+}
+
+template<typename EventKeyType, typename Hash>
+void EventBus<EventKeyType, Hash>::Unfreeze()
+{
+    frozen_ = false;
+    frozenIndex_.Clear();
+    frozenEntries_.clear();
+}
+
 // 订阅者查询实现
 template<typename EventKeyType, typename Hash>
 bool EventBus<EventKeyType, Hash>::HasSubscribers(const EventKeyType& eventName) const
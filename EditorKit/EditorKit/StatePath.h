@@ -7,6 +7,8 @@
 #include <variant>
 #include <functional>
 #include <cassert>
+#include <deque>
+#include <unordered_set>
 #include "StatePathListener.h"
 #include "StateNode.h"
 
@@ -19,8 +21,32 @@ class StatePath
 private:
     ObjectNode* root;
     EventManager eventManager;
+    AsyncEventQueue asyncQueue;
     bool enableEvents = true;
     std::function<void(const char*)> errorCallback; // ص
+
+    // صв¼ӳٷַģʽʹã
+    struct DeferredEvent
+    {
+        EventType type;
+        std::string path;
+        std::string relatedPath;
+        NodeType nodeType;
+        size_t cause;             // ¼ʱڷַ¼ eventChain е±
+    };
+    // ִѷַ¼ѭ
+    struct ChainNode
+    {
+        EventType type;
+        std::string path;
+        size_t cause;             // ¼±꣬¼Ϊ npos
+    };
+    bool deferNestedEvents = false;       // صв¼Ƿӳٵصַ
+    size_t maxEventPropagation = 1024;    // ִַӳ¼
+    int dispatchDepth = 0;                // ǰǶ׷ַ
+    std::deque<DeferredEvent> deferredEvents;
+    std::vector<ChainNode> eventChain;
+    size_t currentCause = 0;              // ǰڷַ¼ eventChain е±꣨0 Ϊ¼
         // Ĭϴ
     static void defaultErrorHandler(const char* errorMsg)
     {
@@ -40,24 +66,153 @@ private:
         }
     }
 
-    // ¼
-    void triggerEvent(EventType type, const std::string& path,
-        const std::string& relatedPath = "",
+    // ¼ûƥļʱֱӷأκζ
+    void triggerEvent(EventType type, std::string_view path,
+        std::string_view relatedPath = std::string_view(),
         BaseNode* node = nullptr)
     {
-        if (!enableEvents) return;
+        if (!enableEvents || eventManager.empty()) return;
+
+        NodeType nodeType = node ? node->getType() : NodeType::EMPTY;
+        if (deferNestedEvents && dispatchDepth > 0)
+        {
+            // صв¼ӣַ˳
+            deferredEvents.push_back({ type, std::string(path), std::string(relatedPath), nodeType, currentCause });
+            return;
+        }
+
+        if (dispatchDepth > 0)
+        {
+            dispatchEvent(type, path, relatedPath, node, nodeType);
+            return;
+        }
 
-        PathEvent event;
-        event.type = type;
-        event.path = path;
-        event.relatedPath = relatedPath;
-        event.node = node;
-        event.nodeType = node ? node->getType() : NodeType::EMPTY;
+        // ַص׳쳣ʱδӳ¼֮Ĵ
+        struct PropagationGuard
+        {
+            StatePath& system;
+            ~PropagationGuard()
+            {
+                system.deferredEvents.clear();
+                system.eventChain.clear();
+            }
+        } propagationGuard{ *this };
 
+        currentCause = 0;
+        dispatchEvent(type, path, relatedPath, node, nodeType);
+
+        if (!deferredEvents.empty())
+        {
+            processDeferredEvents(type, path);
+        }
+    }
+
+    // ַ¼
+    void dispatchEvent(EventType type, std::string_view path, std::string_view relatedPath,
+        BaseNode* node, NodeType nodeType)
+    {
         auto listeners = eventManager.findListeners(path, type);
+        if (listeners.empty()) return;
+
+        PathEvent event{ type, PathRef(path), PathRef(relatedPath), node, nodeType };
+
+        // ص׳쳣ʱҲҪַָ
+        struct DepthGuard
+        {
+            int& depth;
+            explicit DepthGuard(int& d) : depth(d) { ++depth; }
+            ~DepthGuard() { --depth; }
+        } depthGuard(dispatchDepth);
+
+        std::shared_ptr<const PathEventRecord> record; // ڴ첽ʱ
         for (const auto& listener : listeners)
         {
-            listener.callback(event);
+            if (listener.async)
+            {
+                if (!record)
+                {
+                    record = std::make_shared<const PathEventRecord>(PathEventRecord{
+                        type, std::string(path), std::string(relatedPath), nodeType, snapshotValue(node) });
+                }
+                asyncQueue.push(listener.id, record);
+            }
+            else
+            {
+                (*listener.callback)(event);
+            }
+        }
+    }
+
+    // ϲң¼ͬ·ӴʱΪѭ
+    bool isEventCycle(const DeferredEvent& deferred) const
+    {
+        for (size_t index = deferred.cause; index != std::string::npos; index = eventChain[index].cause)
+        {
+            const ChainNode& ancestor = eventChain[index];
+            if (ancestor.type == deferred.type && ancestor.path == deferred.path)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // ȴӳ¼ֻظֵ (, ·)ͬͬһ·ظ޸ճַ
+    void processDeferredEvents(EventType originType, std::string_view originPath)
+    {
+        eventChain.clear();
+        eventChain.push_back({ originType, std::string(originPath), std::string::npos });
+        size_t processed = 0;
+
+        while (!deferredEvents.empty())
+        {
+            if (processed >= maxEventPropagation)
+            {
+                triggerError("Event propagation budget exceeded, dropped " +
+                    std::to_string(deferredEvents.size()) + " pending events");
+                deferredEvents.clear();
+                break;
+            }
+
+            DeferredEvent deferred = std::move(deferredEvents.front());
+            deferredEvents.pop_front();
+
+            if (isEventCycle(deferred))
+            {
+                triggerError("Event cycle detected at path: " + deferred.path);
+                continue;
+            }
+            ++processed;
+            currentCause = eventChain.size();
+            eventChain.push_back({ deferred.type, deferred.path, deferred.cause });
+
+            // ڵѱ޸滻ɾַʱ¶λ
+            BaseNode* node = nullptr;
+            if (deferred.type == EventType::MOVE)
+            {
+                node = getNode(deferred.relatedPath);
+            }
+            else if (deferred.type != EventType::REMOVE)
+            {
+                node = getNode(deferred.path);
+            }
+            dispatchEvent(deferred.type, deferred.path, deferred.relatedPath, node,
+                node ? node->getType() : deferred.nodeType);
+        }
+    }
+
+    // ȡڵֵ
+    static PathValue snapshotValue(BaseNode* node)
+    {
+        if (!node) return PathValue();
+        switch (node->getType())
+        {
+        case NodeType::INT: return static_cast<IntNode*>(node)->getValue();
+        case NodeType::FLOAT: return static_cast<FloatNode*>(node)->getValue();
+        case NodeType::BOOL: return static_cast<BoolNode*>(node)->getValue();
+        case NodeType::POINTER: return static_cast<PointerNode*>(node)->getValue();
+        case NodeType::STRING: return static_cast<StringNode*>(node)->getValue();
+        default: return PathValue();
         }
     }
 public:
@@ -68,17 +223,133 @@ public:
         return eventManager.addListener(path, granularity, eventType, callback);
     }
 
+    // 첽¼صڵ̻߳ dispatchAsyncEvents() а˳ִУ
+    ListenerId addAsyncEventListener(const std::string& path, ListenGranularity granularity,
+        EventType eventType, AsyncEventCallback callback)
+    {
+        ListenerId id = eventManager.addListener(path, granularity, eventType, nullptr, true);
+        asyncQueue.registerCallback(id, std::move(callback));
+        return id;
+    }
+
+    // ӰͶݵļCOALESCED_PER_FRAME ÿ֡ϲһΣMAX_RATE ÿ maxCallsPerSecond 
+    // ֺϲԶҪÿ֡ flushBatchedEvents() Ͷ
+    ListenerId addBatchedEventListener(const std::string& path, ListenGranularity granularity,
+        EventType eventType, DeliveryPolicy policy, BatchEventCallback callback, double maxCallsPerSecond = 0.0)
+    {
+        return eventManager.addBatchedListener(path, granularity, eventType, policy,
+            std::move(callback), maxCallsPerSecond);
+    }
+
+    // Ͷݺϲ۵ıػص
+    size_t flushBatchedEvents()
+    {
+        return eventManager.flushBatched();
+    }
+
     // Ƴ¼
     bool removeEventListener(ListenerId id)
     {
+        asyncQueue.unregisterCallback(id);
         return eventManager.removeListener(id);
     }
 
+    // ڵǰ߳Ͷд첽¼Ͷ
+    size_t dispatchAsyncEvents()
+    {
+        return asyncQueue.dispatch();
+    }
+
+    // ȡͶݵ첽¼
+    size_t getPendingAsyncEventCount()
+    {
+        return asyncQueue.pendingCount();
+    }
+
+    // /ֹͣ첽¼߳
+    void startAsyncDispatcher()
+    {
+        asyncQueue.startDispatcher();
+    }
+
+    void stopAsyncDispatcher()
+    {
+        asyncQueue.stopDispatcher();
+    }
+
     // /¼
     void setEventEnabled(bool enabled)
     {
         enableEvents = enabled;
     }
+
+    // /ӳٷַúصв¼ٵݹַ
+    // صغ󰴹˳ѭ
+    void setDeferredDispatch(bool enabled)
+    {
+        deferNestedEvents = enabled;
+    }
+
+    // õִַӳ¼
+    void setMaxEventPropagation(size_t maxEvents)
+    {
+        maxEventPropagation = maxEvents;
+    }
+
+    // ָ¼ýڵ㱾Ӱ·Ƕ
+    void muteSubtree(const std::string& path)
+    {
+        eventManager.muteSubtree(path);
+    }
+
+    // ȡһξظ·Ƿھ״̬
+    bool unmuteSubtree(const std::string& path)
+    {
+        return eventManager.unmuteSubtree(path);
+    }
+
+    // ǰ׺Ľڵڵ㣩
+    size_t getListenerNodeCount() const
+    {
+        return eventManager.nodeCount();
+    }
+
+    // ʱʱָ
+    class ScopedSubtreeMute
+    {
+    private:
+        StatePath* system;
+        std::string path;
+
+    public:
+        ScopedSubtreeMute(StatePath& sys, const std::string& p) : system(&sys), path(p)
+        {
+            system->muteSubtree(path);
+        }
+
+        ScopedSubtreeMute(ScopedSubtreeMute&& other) noexcept
+            : system(other.system), path(std::move(other.path))
+        {
+            other.system = nullptr;
+        }
+
+        ScopedSubtreeMute(const ScopedSubtreeMute&) = delete;
+        ScopedSubtreeMute& operator=(const ScopedSubtreeMute&) = delete;
+        ScopedSubtreeMute& operator=(ScopedSubtreeMute&&) = delete;
+
+        ~ScopedSubtreeMute()
+        {
+            if (system)
+            {
+                system->unmuteSubtree(path);
+            }
+        }
+    };
+
+    ScopedSubtreeMute muteSubtreeScoped(const std::string& path)
+    {
+        return ScopedSubtreeMute(*this, path);
+    }
 private:
     // ָ·
     std::vector<std::string> splitPath(const std::string& path) const
@@ -250,6 +521,7 @@ public:
 
     ~StatePath()
     {
+        asyncQueue.stopDispatcher();
         delete root;
     }
 
@@ -1,6 +1,15 @@
 #pragma once
 #include "StateNode.h"
 #include <unordered_set>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <variant>
+#include <string_view>
+#include <algorithm>
+#include <chrono>
 // ڵö
 
 
@@ -24,12 +33,46 @@ enum class ListenGranularity
 
 class BaseNode;
 
-// ¼Ϣṹ
+// ·ãֻôе·ַҪʱ std::string
+// ע⣺ڻصִڼЧҪʱ str() ƣ
+class PathRef
+{
+private:
+    std::string_view view_;
+
+public:
+    PathRef() = default;
+    PathRef(std::string_view view) : view_(view) {}
+    PathRef(const std::string& str) : view_(str) {}
+    PathRef(const char* str) : view_(str ? std::string_view(str) : std::string_view()) {}
+
+    std::string_view view() const { return view_; }
+    std::string str() const { return std::string(view_); }
+    operator std::string() const { return str(); }
+
+    bool empty() const { return view_.empty(); }
+    size_t size() const { return view_.size(); }
+
+    friend bool operator==(const PathRef& lhs, const PathRef& rhs) { return lhs.view_ == rhs.view_; }
+    friend bool operator!=(const PathRef& lhs, const PathRef& rhs) { return lhs.view_ != rhs.view_; }
+
+    friend std::string operator+(const std::string& lhs, const PathRef& rhs) { return lhs + rhs.str(); }
+    friend std::string operator+(const char* lhs, const PathRef& rhs) { return std::string(lhs) + rhs.str(); }
+    friend std::string operator+(const PathRef& lhs, const std::string& rhs) { return lhs.str() + rhs; }
+    friend std::string operator+(const PathRef& lhs, const char* rhs) { return lhs.str() + rhs; }
+
+    friend std::ostream& operator<<(std::ostream& os, const PathRef& ref)
+    {
+        return os << ref.view_;
+    }
+};
+
+// ¼Ϣṹַڴ䣩
 struct PathEvent
 {
     EventType type;
-    std::string path;           // ¼·
-    std::string relatedPath;    // ·ƶĿ·
+    PathRef path;               // ¼·
+    PathRef relatedPath;        // ·ƶĿ·
     BaseNode* node;             // 漰Ľڵ
     NodeType nodeType;          // ڵ
 };
@@ -37,27 +80,155 @@ struct PathEvent
 // ¼ص
 using EventCallback = std::function<void(const PathEvent&)>;
 
+// ڵֵգOBJECT/EMPTY ڵΪ monostate
+using PathValue = std::variant<std::monostate, int, float, bool, void*, std::string>;
+
+// 첽¼¼ӵȫݣɿ̡߳ӳͶ
+struct PathEventRecord
+{
+    EventType type;
+    std::string path;
+    std::string relatedPath;
+    NodeType nodeType;
+    PathValue value;            // ¼ʱĽڵֵ
+};
+
+// 첽¼ص
+using AsyncEventCallback = std::function<void(const PathEventRecord&)>;
+
+// ¼صͣΪϴͶ仯·״α仯˳
+using BatchEventCallback = std::function<void(const std::vector<std::string>& changedPaths)>;
+
 // ʶ
 using ListenerId = size_t;
 
+// Ͷݲ
+enum class DeliveryPolicy
+{
+    IMMEDIATE,            // ÿα
+    COALESCED_PER_FRAME,  // ÿ֡ϲΪһεã flushBatched ʱͶݣ
+    MAX_RATE              // Ƶʣ flushBatched ʱͶݣ
+};
+
+// ϲͶݵļ״̬¼ʱֻ¼ͶƳٵ flushBatched
+class BatchedListenerState
+{
+private:
+    DeliveryPolicy policy;
+    std::chrono::steady_clock::duration minInterval;
+    std::chrono::steady_clock::time_point lastDelivery;
+    BatchEventCallback callback;
+    std::deque<std::string> changedPaths;               // deque ֤Ԫصַȶ
+    std::unordered_set<std::string_view> changedSet;    //  changedPaths еַ
+    bool dirty = false;
+    bool removed = false;
+
+public:
+    BatchedListenerState(DeliveryPolicy deliveryPolicy, double maxCallsPerSecond, BatchEventCallback batchCallback)
+        : policy(deliveryPolicy), minInterval(std::chrono::steady_clock::duration::zero()),
+        callback(std::move(batchCallback))
+    {
+        if (policy == DeliveryPolicy::MAX_RATE && maxCallsPerSecond > 0.0)
+        {
+            minInterval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(1.0 / maxCallsPerSecond));
+        }
+    }
+
+    // ¼һαǷɸɾΪࣨҪͶб
+    bool markChanged(std::string_view path)
+    {
+        if (changedSet.find(path) == changedSet.end())
+        {
+            changedPaths.emplace_back(path);
+            changedSet.insert(changedPaths.back());
+        }
+        bool becameDirty = !dirty;
+        dirty = true;
+        return becameDirty;
+    }
+
+    // Ͷݲ trueδڷ falseִͶݣ
+    bool deliverIfDue(std::chrono::steady_clock::time_point now)
+    {
+        if (removed || !dirty)
+        {
+            return true;
+        }
+        if (policy == DeliveryPolicy::MAX_RATE && now - lastDelivery < minInterval)
+        {
+            return false;
+        }
+
+        std::vector<std::string> paths(std::make_move_iterator(changedPaths.begin()),
+            std::make_move_iterator(changedPaths.end()));
+        changedSet.clear();
+        changedPaths.clear();
+        dirty = false;
+        lastDelivery = now;
+        callback(paths);
+        return true;
+    }
+
+    void markRemoved() { removed = true; }
+    bool isDirty() const { return dirty; }
+};
+
 // Ϣ
 struct ListenerInfo
 {
     ListenerId id;
     std::string path;
     ListenGranularity granularity;
-    EventCallback callback;
+    std::shared_ptr<const EventCallback> callback; // УصƳҲȫ
     EventType eventType; // ¼
+    bool async = false;  // 첽¼У AsyncEventQueue Ͷ
+    std::shared_ptr<BatchedListenerState> batch; // ǿձʾϲͶݵļ
+};
+
+// ƥֻƷַϢ
+struct ListenerMatch
+{
+    ListenerId id;
+    bool async;
+    std::shared_ptr<const EventCallback> callback;
 };
 
+// ·ֶεնΣڴ
+inline bool nextPathPart(std::string_view path, size_t& pos, std::string_view& part)
+{
+    while (pos < path.size())
+    {
+        size_t end = path.find('/', pos);
+        if (end == std::string_view::npos)
+        {
+            end = path.size();
+        }
+        part = path.substr(pos, end - pos);
+        pos = end + 1;
+        if (!part.empty())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 // ǰ׺ڵ
 class EventTrieNode
 {
 private:
-    std::unordered_map<std::string, EventTrieNode*> children;
+    std::string name;                                               // ڵchildren ļ
+    std::unordered_map<std::string_view, EventTrieNode*> children;
     std::vector<ListenerInfo> listeners;
+    int muteCount = 0;                                              // >0 ʱ¼
 
 public:
+    EventTrieNode() = default;
+    explicit EventTrieNode(std::string_view part) : name(part) {}
+    EventTrieNode(const EventTrieNode&) = delete;
+    EventTrieNode& operator=(const EventTrieNode&) = delete;
+
     ~EventTrieNode()
     {
         for (auto& pair : children)
@@ -66,22 +237,49 @@ public:
         }
     }
 
-    EventTrieNode* getOrCreateChild(const std::string& part)
+    EventTrieNode* getOrCreateChild(std::string_view part)
     {
         auto it = children.find(part);
         if (it == children.end())
         {
-            it = children.emplace(part, new EventTrieNode()).first;
+            EventTrieNode* child = new EventTrieNode(part);
+            it = children.emplace(std::string_view(child->name), child).first;
         }
         return it->second;
     }
 
-    EventTrieNode* getChild(const std::string& part) const
+    EventTrieNode* getChild(std::string_view part) const
     {
         auto it = children.find(part);
         return it != children.end() ? it->second : nullptr;
     }
 
+    void removeChild(std::string_view part)
+    {
+        auto it = children.find(part);
+        if (it == children.end()) return;
+        EventTrieNode* child = it->second;
+        children.erase(it); //  child->nameƳͷ
+        delete child;
+    }
+
+    // ûмδûӽڵʱԴӸڵɾ
+    bool isPrunable() const
+    {
+        return listeners.empty() && muteCount == 0 && children.empty();
+    }
+
+    // ڵ
+    size_t nodeCount() const
+    {
+        size_t count = 1;
+        for (const auto& pair : children)
+        {
+            count += pair.second->nodeCount();
+        }
+        return count;
+    }
+
     void addListener(const ListenerInfo& listener)
     {
         listeners.push_back(listener);
@@ -99,13 +297,22 @@ public:
         return false;
     }
 
-    // ֻȡǰڵļݹӽڵ㣩
-    std::vector<ListenerInfo> getCurrentListeners() const
+    void mute() { ++muteCount; }
+    bool unmute()
+    {
+        if (muteCount == 0) return false;
+        --muteCount;
+        return true;
+    }
+    bool isMuted() const { return muteCount > 0; }
+
+    // ֻȡǰڵļݹӽڵ㣩
+    const std::vector<ListenerInfo>& getCurrentListeners() const
     {
         return listeners;
     }
 
-    // ȡֱӽڵ
+    // ȡֱӽڵ
     std::vector<ListenerInfo> getDirectChildListeners() const
     {
         std::vector<ListenerInfo> result;
@@ -118,9 +325,6 @@ public:
         }
         return result;
     }
-
-    // ɾĵݹ鷽
-    // void getMatchingListeners(...)  // ɾ
 };
 
 class EventManager
@@ -129,32 +333,94 @@ private:
     EventTrieNode root;
     ListenerId nextId = 1;
     std::unordered_map<ListenerId, std::string> listenerPaths;
+    std::unordered_map<ListenerId, std::shared_ptr<BatchedListenerState>> batchedListeners;
+    std::vector<std::shared_ptr<BatchedListenerState>> dirtyBatches; // Ͷݵĺϲ
 
-    std::vector<std::string> splitPath(const std::string& path) const
+    // ж listenerPath Ƿ path ǰ count  '/' ӵĽ
+    static bool equalsLeadingParts(std::string_view listenerPath, std::string_view path, size_t count)
     {
-        std::vector<std::string> parts;
-        std::stringstream ss(path);
-        std::string part;
-        while (std::getline(ss, part, '/'))
+        size_t pos = 0;
+        size_t offset = 0;
+        std::string_view part;
+        for (size_t i = 0; i < count && nextPathPart(path, pos, part); ++i)
         {
-            if (!part.empty())
+            if (i > 0)
             {
-                parts.push_back(part);
+                if (offset >= listenerPath.size() || listenerPath[offset] != '/') return false;
+                ++offset;
             }
+            if (listenerPath.compare(offset, part.size(), part) != 0) return false;
+            offset += part.size();
         }
-        return parts;
+        return offset == listenerPath.size();
     }
 
-public:
-    ListenerId addListener(const std::string& path, ListenGranularity granularity,
-        EventType eventType, EventCallback callback)
+    static bool hasPrefix(std::string_view path, const std::string& prefix)
+    {
+        return path.compare(0, prefix.size(), prefix) == 0;
+    }
+
+    static bool matchesAncestor(const ListenerInfo& listener, std::string_view path, EventType eventType)
+    {
+        return listener.eventType == eventType &&
+            listener.granularity == ListenGranularity::ALL_CHILDREN &&
+            hasPrefix(path, listener.path);
+    }
+
+    // ·ռڵ㣬branch[i] ӽڵ branch[i + 1] Ӧ· i Σ·ʱ false
+    bool collectBranch(std::string_view path, std::vector<std::pair<EventTrieNode*, std::string_view>>& branch)
+    {
+        EventTrieNode* node = &root;
+        size_t pos = 0;
+        std::string_view part;
+        while (nextPathPart(path, pos, part))
+        {
+            branch.emplace_back(node, part);
+            node = node->getChild(part);
+            if (!node) return false;
+        }
+        branch.emplace_back(node, std::string_view());
+        return true;
+    }
+
+    // ¶ɾ·ϲҪĽڵ㣬⾲ע·ǰ׺ֻ
+    static void pruneBranch(const std::vector<std::pair<EventTrieNode*, std::string_view>>& branch)
+    {
+        for (size_t i = branch.size() - 1; i > 0; --i)
+        {
+            if (!branch[i].first->isPrunable()) break;
+            branch[i - 1].first->removeChild(branch[i - 1].second);
+        }
+    }
+
+    // ϲͶݵļֻ࣬ƥ
+    void appendMatch(std::vector<ListenerMatch>& result, const ListenerInfo& listener, std::string_view path)
+    {
+        if (listener.batch)
+        {
+            if (listener.batch->markChanged(path))
+            {
+                dirtyBatches.push_back(listener.batch);
+            }
+            return;
+        }
+        result.push_back({ listener.id, listener.async, listener.callback });
+    }
+
+    ListenerId insertListener(const std::string& path, ListenGranularity granularity, EventType eventType,
+        std::shared_ptr<const EventCallback> callback, bool async, std::shared_ptr<BatchedListenerState> batch)
     {
         ListenerId id = nextId++;
-        ListenerInfo info{ id, path, granularity, callback, eventType };
+        if (batch)
+        {
+            batchedListeners[id] = batch;
+        }
+        ListenerInfo info{ id, path, granularity, std::move(callback), eventType, async, std::move(batch) };
 
-        auto parts = splitPath(path);
         EventTrieNode* node = &root;
-        for (const auto& part : parts)
+        size_t pos = 0;
+        std::string_view part;
+        while (nextPathPart(path, pos, part))
         {
             node = node->getOrCreateChild(part);
         }
@@ -164,6 +430,76 @@ public:
         return id;
     }
 
+public:
+    ListenerId addListener(const std::string& path, ListenGranularity granularity,
+        EventType eventType, EventCallback callback, bool async = false)
+    {
+        std::shared_ptr<const EventCallback> sharedCallback;
+        if (callback)
+        {
+            sharedCallback = std::make_shared<const EventCallback>(std::move(callback));
+        }
+        return insertListener(path, granularity, eventType, std::move(sharedCallback), async, nullptr);
+    }
+
+    // ӺϲͶݵļ
+    ListenerId addBatchedListener(const std::string& path, ListenGranularity granularity,
+        EventType eventType, DeliveryPolicy policy, BatchEventCallback callback, double maxCallsPerSecond = 0.0)
+    {
+        if (policy == DeliveryPolicy::IMMEDIATE)
+        {
+            return addListener(path, granularity, eventType,
+                [callback = std::move(callback)](const PathEvent& event)
+                {
+                    callback(std::vector<std::string>{ event.path.str() });
+                });
+        }
+
+        return insertListener(path, granularity, eventType, nullptr, false,
+            std::make_shared<BatchedListenerState>(policy, maxCallsPerSecond, std::move(callback)));
+    }
+
+    // ͶеڵĺϲػصӦÿ֡һΣ
+    // ص׳쳣ʱ׳쳣ļ֮δļŻشͶб÷׳
+    size_t flushBatched()
+    {
+        if (dirtyBatches.empty())
+        {
+            return 0;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        std::vector<std::shared_ptr<BatchedListenerState>> batches;
+        batches.swap(dirtyBatches); // صв±µб
+
+        size_t delivered = 0;
+        size_t next = 0;
+        try
+        {
+            for (; next < batches.size(); ++next)
+            {
+                auto& batch = batches[next];
+                bool wasDirty = batch->isDirty();
+                if (!batch->deliverIfDue(now))
+                {
+                    dirtyBatches.push_back(std::move(batch));
+                }
+                else if (wasDirty && !batch->isDirty())
+                {
+                    ++delivered;
+                }
+            }
+        }
+        catch (...)
+        {
+            // ЩԴ״̬markChangedٰǼбԶղͶ
+            dirtyBatches.insert(dirtyBatches.end(),
+                std::make_move_iterator(batches.begin() + next), std::make_move_iterator(batches.end()));
+            throw;
+        }
+        return delivered;
+    }
+
     bool removeListener(ListenerId id)
     {
         auto it = listenerPaths.find(id);
@@ -172,132 +508,327 @@ public:
             return false;
         }
 
-        std::string path = it->second;
+        std::string path = std::move(it->second);
         listenerPaths.erase(it);
 
-        auto parts = splitPath(path);
+        auto batchIt = batchedListeners.find(id);
+        if (batchIt != batchedListeners.end())
+        {
+            batchIt->second->markRemoved();
+            batchedListeners.erase(batchIt);
+        }
+
+        std::vector<std::pair<EventTrieNode*, std::string_view>> branch;
+        if (!collectBranch(path, branch) || !branch.back().first->removeListener(id))
+        {
+            return false;
+        }
+        pruneBranch(branch);
+        return true;
+    }
+
+    // Ƕף unmuteSubtree ɶԵã
+    void muteSubtree(const std::string& path)
+    {
         EventTrieNode* node = &root;
-        for (const auto& part : parts)
+        size_t pos = 0;
+        std::string_view part;
+        while (nextPathPart(path, pos, part))
         {
-            node = node->getChild(part);
-            if (!node) return false;
+            node = node->getOrCreateChild(part);
         }
+        node->mute();
+    }
 
-        return node->removeListener(id);
+    bool unmuteSubtree(const std::string& path)
+    {
+        std::vector<std::pair<EventTrieNode*, std::string_view>> branch;
+        if (!collectBranch(path, branch) || !branch.back().first->unmute())
+        {
+            return false;
+        }
+        pruneBranch(branch);
+        return true;
     }
 
-    std::vector<ListenerInfo> findListeners(const std::string& path, EventType eventType)
+    // ǰ׺ڵڵ㣩ȷϾעĽڵ㱻
+    size_t nodeCount() const
     {
-        std::vector<ListenerInfo> result;
-        auto parts = splitPath(path);
+        return root.nodeCount();
+    }
 
-        // ʹüظļ
-        std::unordered_set<ListenerId> addedIds;
+    // Ƿûκμ
+    bool empty() const
+    {
+        return listenerPaths.empty();
+    }
 
-        // 1. ȴȷƥĽڵ
-        EventTrieNode* exactNode = &root;
-        for (const auto& part : parts)
+    // ƥļƥʱκڴ
+    // ϲͶݵļڴ˴ֱ࣬ڷؽ
+    std::vector<ListenerMatch> findListeners(std::string_view path, EventType eventType)
+    {
+        std::vector<ListenerMatch> result;
+
+        /* ֻ·һΣλȷڵ븸ڵ㣬´ƥ ALL_CHILDREN Ƚڵ
+        *;ڵʱֱӷأϲиãȷ·δ׷ƥ
+        */
+        std::vector<const EventTrieNode*> ancestors; // ڴƥʱ
+        const EventTrieNode* exactNode = &root;
+        const EventTrieNode* parentNode = nullptr;
+        size_t partCount = 0;
+        size_t pos = 0;
+        std::string_view part;
+        if (root.isMuted()) return result;
+        while (nextPathPart(path, pos, part))
         {
+            if (!exactNode)
+            {
+                parentNode = nullptr; // мڵȱʧڵҲ
+                break;
+            }
+            if (exactNode != &root)
+            {
+                const auto& listeners = exactNode->getCurrentListeners();
+                if (std::any_of(listeners.begin(), listeners.end(),
+                    [&](const ListenerInfo& listener) { return matchesAncestor(listener, path, eventType); }))
+                {
+                    ancestors.push_back(exactNode);
+                }
+            }
+            parentNode = exactNode;
             exactNode = exactNode->getChild(part);
-            if (!exactNode) break;
+            ++partCount;
+            if (exactNode && exactNode->isMuted()) return result;
         }
 
+        // 1. ȷƥڵ㣺NODE Ҫ·ȫһ£ALL_CHILDREN ֻҪǰ׺ƥ
         if (exactNode)
         {
-            // ȡȷڵļݹӽڵ㣩
-            auto exactListeners = exactNode->getCurrentListeners();
-            for (const auto& listener : exactListeners)
+            for (const auto& listener : exactNode->getCurrentListeners())
             {
-                if (listener.eventType == eventType &&
-                    addedIds.find(listener.id) == addedIds.end())
+                if (listener.eventType != eventType) continue;
+                if (listener.granularity == ListenGranularity::NODE)
                 {
-                    // ȣNODE Ҫȷƥ·
-                    if (listener.granularity == ListenGranularity::NODE)
+                    if (listener.path == path)
                     {
-                        if (listener.path == path)
-                        {
-                            result.push_back(listener);
-                            addedIds.insert(listener.id);
-                        }
+                        appendMatch(result, listener, path);
                     }
-                    // ALL_CHILDREN ֻҪǰ׺ƥ
-                    else if (listener.granularity == ListenGranularity::ALL_CHILDREN)
+                }
+                else if (listener.granularity == ListenGranularity::ALL_CHILDREN)
+                {
+                    if (hasPrefix(path, listener.path))
                     {
-                        if (path.find(listener.path) == 0) // ǰ׺ƥ
-                        {
-                            result.push_back(listener);
-                            addedIds.insert(listener.id);
-                        }
+                        appendMatch(result, listener, path);
                     }
                 }
             }
         }
 
-        // 2. ֱӽڵ
-        if (parts.size() > 0)
+        // 2. ڵϵ DIRECT_CHILD 
+        if (parentNode && partCount > 0)
+        {
+            for (const auto& listener : parentNode->getCurrentListeners())
+            {
+                if (listener.eventType == eventType &&
+                    listener.granularity == ListenGranularity::DIRECT_CHILD &&
+                    equalsLeadingParts(listener.path, path, partCount - 1)) // עڸ·
+                {
+                    appendMatch(result, listener, path);
+                }
+            }
+        }
+
+        // 3. Ƚڵ ALL_CHILDREN ȷڵڵ 1 ϵµ˳
+        for (const EventTrieNode* ancestor : ancestors)
+        {
+            for (const auto& listener : ancestor->getCurrentListeners())
+            {
+                if (matchesAncestor(listener, path, eventType))
+                {
+                    appendMatch(result, listener, path);
+                }
+            }
+        }
+
+        return result;
+    }
+};
+
+// 첽¼Уֻ߳ӣ¼˳ڵ̻߳ dispatch() õͶ
+class AsyncEventQueue
+{
+private:
+    struct PendingEvent
+    {
+        ListenerId listenerId;
+        std::shared_ptr<const PathEventRecord> record; // ͬһ¼Ķ첽һݼ¼
+    };
+
+    std::unordered_map<ListenerId, std::shared_ptr<AsyncEventCallback>> callbacks;
+    std::deque<PendingEvent> pending;
+    std::mutex mutex;                 //  callbacks  pending
+    std::condition_variable deliveryFinished;
+    std::thread::id deliveringThread; // ǰͶߣ֤ͬһʱֻһͶߣά¼˳
+    std::condition_variable condition;
+    std::thread dispatcher;
+    bool stopRequested = false;
+
+    /* ȡͶ¼λصֱΪ
+    *صڲκִУصٴͶݣdispatchAsyncEvents 򴥷ͬնе޸ģʱֱӷأ
+    *ӵ¼ͶڱֽͶ
+    *ص׳쳣ʱδͶݵ¼ԭ˳Żضͷ÷׳׳쳣¼ΪͶ
+    */
+    size_t deliverPending()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        const std::thread::id self = std::this_thread::get_id();
+        if (deliveringThread == self)
         {
-            // ·
-            std::string parentPath;
-            for (size_t i = 0; i < parts.size() - 1; ++i)
+            return 0;
+        }
+        deliveryFinished.wait(lock, [this] { return deliveringThread == std::thread::id(); });
+        deliveringThread = self;
+
+        // ص׳쳣ʱͬͷͶȨ֮Ͷõȴ
+        struct DeliveryGuard
+        {
+            AsyncEventQueue* queue;
+            std::unique_lock<std::mutex>& lock;
+            ~DeliveryGuard()
             {
-                parentPath += (i > 0 ? "/" : "") + parts[i];
+                if (!lock.owns_lock())
+                {
+                    lock.lock();
+                }
+                queue->deliveringThread = std::thread::id();
+                queue->deliveryFinished.notify_all();
             }
+        } guard{ this, lock };
 
-            // ҵڵ
-            auto parentParts = splitPath(parentPath);
-            EventTrieNode* parentNode = &root;
-            for (const auto& part : parentParts)
+        size_t delivered = 0;
+        std::vector<std::pair<std::shared_ptr<AsyncEventCallback>, PendingEvent>> batch;
+        while (!pending.empty())
+        {
+            batch.clear();
+            batch.reserve(pending.size());
+            for (auto& event : pending)
             {
-                parentNode = parentNode->getChild(part);
-                if (!parentNode) break;
+                auto it = callbacks.find(event.listenerId);
+                if (it != callbacks.end()) // ƳļͶ
+                {
+                    batch.emplace_back(it->second, std::move(event));
+                }
             }
+            pending.clear();
 
-            if (parentNode)
+            lock.unlock();
+            size_t next = 0;
+            try
             {
-                auto directChildListeners = parentNode->getDirectChildListeners();
-                for (const auto& listener : directChildListeners)
+                for (; next < batch.size(); ++next)
                 {
-                    if (listener.eventType == eventType &&
-                        listener.path == parentPath && // עڸ·
-                        addedIds.find(listener.id) == addedIds.end())
-                    {
-                        result.push_back(listener);
-                        addedIds.insert(listener.id);
-                    }
+                    (*batch[next].first)(*batch[next].second.record);
+                }
+            }
+            catch (...)
+            {
+                lock.lock();
+                for (size_t i = batch.size(); i > next + 1; --i)
+                {
+                    pending.push_front(std::move(batch[i - 1].second));
                 }
+                throw;
             }
+            delivered += batch.size();
+            lock.lock();
         }
+        return delivered;
+    }
+
+    void dispatcherLoop()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true)
+        {
+            condition.wait(lock, [this] { return stopRequested || !pending.empty(); });
+            if (pending.empty() && stopRequested)
+            {
+                return;
+            }
+            lock.unlock();
+            deliverPending();
+            lock.lock();
+        }
+    }
+
+public:
+    ~AsyncEventQueue()
+    {
+        stopDispatcher();
+    }
+
+    void registerCallback(ListenerId id, AsyncEventCallback callback)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        callbacks[id] = std::make_shared<AsyncEventCallback>(std::move(callback));
+    }
 
-        // 3. Ƚڵ ALL_CHILDREN 
-        EventTrieNode* currentNode = &root;
-        std::string currentPath;
+    bool unregisterCallback(ListenerId id)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return callbacks.erase(id) > 0;
+    }
 
-        for (size_t i = 0; i < parts.size(); ++i)
+    void push(ListenerId id, std::shared_ptr<const PathEventRecord> record)
+    {
         {
-            currentNode = currentNode->getChild(parts[i]);
-            if (!currentNode) break;
+            std::lock_guard<std::mutex> lock(mutex);
+            pending.push_back({ id, std::move(record) });
+        }
+        condition.notify_one();
+    }
+
+    // ڵ߳Ͷд¼Ͷ
+    size_t dispatch()
+    {
+        return deliverPending();
+    }
 
-            // ǰ·
-            currentPath += (i > 0 ? "/" : "") + parts[i];
+    size_t pendingCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return pending.size();
+    }
 
-            // ȡǰڵ ALL_CHILDREN 
-            auto currentListeners = currentNode->getCurrentListeners();
-            for (const auto& listener : currentListeners)
+    // ̨߳
+    void startDispatcher()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (dispatcher.joinable())
+        {
+            return;
+        }
+        stopRequested = false;
+        dispatcher = std::thread(&AsyncEventQueue::dispatcherLoop, this);
+    }
+
+    // ֹ̨̣ͣ߳˳ǰͶʣ¼
+    void stopDispatcher()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!dispatcher.joinable())
             {
-                if (listener.eventType == eventType &&
-                    listener.granularity == ListenGranularity::ALL_CHILDREN &&
-                    addedIds.find(listener.id) == addedIds.end())
-                {
-                    // ·ǰ׺ƥ
-                    if (path.find(listener.path) == 0)
-                    {
-                        result.push_back(listener);
-                        addedIds.insert(listener.id);
-                    }
-                }
+                return;
             }
+            stopRequested = true;
         }
+        condition.notify_one();
+        dispatcher.join();
+    }
 
-        return result;
+    bool isDispatcherRunning() const
+    {
+        return dispatcher.joinable();
     }
 };
\ No newline at end of file
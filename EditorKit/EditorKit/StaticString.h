@@ -1,10 +1,51 @@
 #pragma once
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include <mutex>
+#include <atomic>
 #include <functional>
 #include <vector>
 #include <iostream>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
+#include <memory>
+#include <stdexcept>
+
+// ڿõ64λFNV-1aַϣ
+constexpr uint64_t StaticStringHash(const char* str, size_t len)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < len; ++i)
+    {
+        hash ^= static_cast<uint8_t>(str[i]);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// ַڹϣ "xxx"_ss 
+struct StaticStringLiteral
+{
+    const char* data;
+    size_t size;
+    uint64_t hash;
+
+    constexpr StaticStringLiteral(const char* str, size_t len)
+        : data(str), size(len), hash(StaticStringHash(str, len))
+    {
+    }
+};
+
+constexpr StaticStringLiteral operator""_ss(const char* str, size_t len)
+{
+    return StaticStringLiteral(str, len);
+}
 
 //ַ̬ΪֵϣЧʽӽ/ö
 //ע⣺޷ʹã
@@ -14,7 +55,14 @@ public:
     // 캯
     StaticString() : StaticString("") {}
     StaticString(const char* str) : id_(getStringId(str)) {}
-    StaticString(const std::string& str) : id_(getStringId(str.c_str())) {}
+    StaticString(const std::string& str) : id_(getStringId(std::string_view(str))) {}
+    StaticString(std::string_view str) : id_(getStringId(str)) {}
+    // 죺ϣڱɣʱֻ
+    StaticString(const StaticStringLiteral& literal)
+        : id_(getCachedStringId(literal.data, literal.size, [&literal]()
+            {
+                return getStringPool().getIdForString(literal.data, literal.size, literal.hash);
+            })) {}
 
     // 캯
     StaticString(const StaticString& other) = default;
@@ -23,24 +71,34 @@ public:
     StaticString& operator=(const StaticString& other) = default;
 
     // ȡֵַ
+    // ע⣺ַ洢ڴУûֳɵstd::stringַ״εstr()ʱڶ
+    // ٷһ浽ַΪֹͷţͬһַڴռ˷
+    // ѷֽPoolStatistics::materializedBytes
+    // ֻȡȽϻʱʹview()c_str()ڽӿڱconst std::string&ʱstr()
     const std::string& str() const
     {
         return getStringById(id_);
     }
 
+    // ȡַͼ޷䣻Կַβ
+    std::string_view view() const
+    {
+        return getViewById(id_);
+    }
+
     // ȡID
     int id() const { return id_; }
 
     // תΪCַ
     const char* c_str() const
     {
-        return getStringById(id_).c_str();
+        return getViewById(id_).data();
     }
 
     // תΪstd::string
     std::string toString() const
     {
-        return getStringById(id_);
+        return std::string(getViewById(id_));
     }
 
     // Ƚ
@@ -51,6 +109,73 @@ public:
     bool operator>(const StaticString& other) const { return id_ > other.id_; }
     bool operator>=(const StaticString& other) const { return id_ >= other.id_; }
 
+    // ַͳϢ
+    struct PoolStatistics
+    {
+        size_t stringCount;         // פַ
+        size_t totalBytes;          // פַַֽ
+        size_t transientCount;      // ʱСδյַ
+        size_t transientBytes;      // ʱַַֽ
+        size_t materializedBytes;   // str()Ϊַstd::stringַֽ
+    };
+
+    static PoolStatistics getPoolStatistics()
+    {
+        StringPool& pool = getStringPool();
+        std::lock_guard<std::mutex> lock(pool.transient.mutex);
+        return PoolStatistics{
+            static_cast<size_t>(pool.nextId.load(std::memory_order_acquire)) + pool.transient.pinnedCount,
+            pool.totalBytes.load(std::memory_order_relaxed),
+            pool.transient.liveCount,
+            pool.transient.liveBytes,
+            pool.materializedBytes.load(std::memory_order_relaxed) };
+    }
+
+    // פַ浽ļʱؿɻϴһµID
+    // ڼ䱻̶ַֻıʹʱIDغID֮ID뱣ʱͬ
+    static bool savePool(const std::string& filePath)
+    {
+        return getStringPool().save(filePath);
+    }
+
+    // savePoolļǰеַļǰ׺ȫһ£κ޸Ĳfalse
+    static bool loadPool(const std::string& filePath)
+    {
+        return getStringPool().load(filePath);
+    }
+
+    // ̱߳زһͳƣͳƵ̣߳
+    struct ThreadCacheStatistics
+    {
+        uint64_t hits;
+        uint64_t misses;
+
+        double hitRate() const
+        {
+            uint64_t total = hits + misses;
+            return total ? static_cast<double>(hits) / static_cast<double>(total) : 0.0;
+        }
+    };
+
+    static ThreadCacheStatistics getThreadCacheStatistics()
+    {
+        const ThreadCache& cache = getThreadCache();
+        return ThreadCacheStatistics{ cache.hits, cache.misses };
+    }
+
+    static void resetThreadCacheStatistics()
+    {
+        ThreadCache& cache = getThreadCache();
+        cache.hits = 0;
+        cache.misses = 0;
+    }
+
+    // ʱפ򣬶
+    class TransientScope;
+
+    // ǷΪɻյʱַڼ䱻פ̶ַID䣬ٿɻգfalse
+    bool isTransient() const { return StringPool::isTransientId(id_) && !getStringPool().isPinnedId(id_); }
+
     // ϣ
     std::size_t hash() const
     {
@@ -59,19 +184,20 @@ public:
     }
 
     // ַ +
+    // ע⣺ÿƴӶפѭƴӼʹStaticStringBuilder
     StaticString operator+(const StaticString& other) const
     {
-        return StaticString(str() + other.str());
+        return StaticString(toString().append(other.view()));
     }
 
     StaticString operator+(const char* other) const
     {
-        return StaticString(str() + other);
+        return StaticString(toString() + other);
     }
 
     StaticString operator+(const std::string& other) const
     {
-        return StaticString(str() + other);
+        return StaticString(toString() + other);
     }
 
     // Ԫ֧ char* + StaticString ʽ
@@ -122,57 +248,640 @@ public:
 
     StaticString& append(const StaticString& other, size_t pos, size_t len = std::string::npos)
     {
-        std::string otherStr = other.str().substr(pos, len);
+        std::string otherStr(other.view().substr(pos, len));
         return operator+=(otherStr);
     }
 
 private:
     int id_;
 
+    struct IdTag {};
+    StaticString(IdTag, int id) : id_(id) {}
+
     // ȫַ
+    // ַֻ洢һݣƬԼڴarena׷д룬Կַβƶ
+    // IDַĿ׷ӣĿֻ¼ָ볤ȣȡ
+    // ַIDӳ䰴ϣƬΪָarenaͼƬIDȫԭӼ
     struct StringPool
     {
-        std::unordered_map<std::string, int> stringToId;  // ַIDӳ
-        std::vector<std::string> idToString;              // IDַӳ
-        std::mutex mutex;                                 // ̰߳ȫ
-        int nextId = 0;                                   // һõID
+        static constexpr int ChunkShift = 10;
+        static constexpr int ChunkSize = 1 << ChunkShift;         // ÿ1024ַ
+        static constexpr int MaxChunks = 1 << 14;                 // Լ1600ַ
+        static constexpr int ShardBits = 4;
+        static constexpr size_t ShardCount = size_t(1) << ShardBits;  // ӳƬ
+        static constexpr size_t ArenaBlockSize = 16 * 1024;       // arenaÿֽ
 
-        int getEmptyStringId()
+        struct Entry
         {
-            std::lock_guard<std::mutex> lock(mutex);
-            if (stringToId.find("") == stringToId.end())
+            const char* data = nullptr;
+            size_t size = 0;
+            mutable std::atomic<std::string*> materialized{ nullptr };  // str()贴ĸ
+        };
+
+        struct Chunk
+        {
+            Entry entries[ChunkSize];
+
+            ~Chunk()
             {
-                stringToId[""] = 0;
-                idToString.push_back("");
+                for (auto& entry : entries)
+                {
+                    delete entry.materialized.load(std::memory_order_relaxed);
+                }
             }
-            return 0;
+        };
+
+        // ֻ׷ӵַڴƬ
+        struct Arena
+        {
+            std::vector<std::unique_ptr<char[]>> blocks;
+            char* current = nullptr;
+            size_t remaining = 0;
+
+            // ַ׷ӿַصĵַڳصڲ
+            const char* store(const char* str, size_t len)
+            {
+                size_t required = len + 1;
+                char* target;
+                if (required > ArenaBlockSize / 4)
+                {
+                    // ַ䣬˷ѵǰʣռ
+                    blocks.emplace_back(new char[required]);
+                    target = blocks.back().get();
+                }
+                else
+                {
+                    if (required > remaining)
+                    {
+                        blocks.emplace_back(new char[ArenaBlockSize]);
+                        current = blocks.back().get();
+                        remaining = ArenaBlockSize;
+                    }
+                    target = current;
+                    current += required;
+                    remaining -= required;
+                }
+                if (len > 0)
+                {
+                    std::memcpy(target, str, len);
+                }
+                target[len] = '\0';
+                return target;
+            }
+        };
+
+        // ӳļָarenaַͼԤõĹϣ
+        // ʱֱõ÷ͼ죬ʱstd::string
+        struct PoolKey
+        {
+            std::string_view text;
+            uint64_t hash;
+
+            bool operator==(const PoolKey& other) const
+            {
+                return hash == other.hash && text == other.text;
+            }
+        };
+
+        struct PoolKeyHash
+        {
+            size_t operator()(const PoolKey& key) const noexcept
+            {
+                return static_cast<size_t>(key.hash);
+            }
+        };
+
+        // ƬȡϣĸλӳλͰMSVC ͰΪ2ݣȡλͬһƬļλȫͬ
+        static size_t shardIndex(uint64_t hash)
+        {
+            return static_cast<size_t>(hash >> (64 - ShardBits));
+        }
+
+        // ƬռУⲻͬƬ໥
+        struct alignas(64) Shard
+        {
+            std::unordered_map<PoolKey, int, PoolKeyHash> stringToId;  // ַIDӳ
+            Arena arena;                                      // Ƭַַ洢
+            std::mutex mutex;                                 // ƬĲ
+        };
+
+        // ʱַIDЧλ30λλΪλλ
+        // λպһIDòλеַ1024ȡģ
+        static constexpr int TransientFlag = 1 << 30;
+        static constexpr int TransientSlotBits = 20;
+        static constexpr int TransientSlotMask = (1 << TransientSlotBits) - 1;
+        static constexpr int TransientGenerationMask = (1 << (30 - TransientSlotBits)) - 1;
+        static constexpr int TransientMaxChunks = (1 << TransientSlotBits) >> ChunkShift;
+
+        struct TransientSlot
+        {
+            std::string text;
+            std::atomic<int> id{ 0 };   // ǰռøòλID0ʾ
+            int generation = 0;
+            int refCount = 0;           // иַ
+            std::atomic<bool> pinned{ false }; // ѱפٻգ޸ɱȡ
+        };
+
+        struct TransientChunk
+        {
+            TransientSlot slots[ChunkSize];
+        };
+
+        // ʱַ޸mutex˳ȷƬ
+        struct TransientTable
+        {
+            std::mutex mutex;
+            std::unordered_map<PoolKey, int, PoolKeyHash> textToId;
+            std::atomic<TransientChunk*> chunks[TransientMaxChunks] = {};
+            std::vector<int> freeSlots;
+            int nextSlot = 0;
+            std::atomic<size_t> liveCount{ 0 };     // δյĲλѹ̶ģ
+            size_t liveBytes = 0;
+            size_t pinnedCount = 0;
+
+            TransientSlot& slot(int id)
+            {
+                int index = id & TransientSlotMask;
+                return chunks[index >> ChunkShift].load(std::memory_order_acquire)->slots[index & (ChunkSize - 1)];
+            }
+        };
+
+        Shard shards[ShardCount];
+        std::atomic<Chunk*> chunks[MaxChunks] = {};       // IDַķֿ洢ַȶ
+        std::atomic<int> nextId{ 0 };                     // һõID
+        std::atomic<size_t> totalBytes{ 0 };              // פַַ
+        mutable std::atomic<size_t> materializedBytes{ 0 };  // str()ĸַ
+        TransientTable transient;
+
+        ~StringPool()
+        {
+            for (auto& chunk : chunks)
+            {
+                delete chunk.load(std::memory_order_relaxed);
+            }
+            for (auto& chunk : transient.chunks)
+            {
+                delete chunk.load(std::memory_order_relaxed);
+            }
+        }
+
+        static bool isTransientId(int id)
+        {
+            return (id & TransientFlag) != 0;
+        }
+
+        // ȡIDڵĿ飬ʱ
+        Chunk* getOrCreateChunk(int id)
+        {
+            std::atomic<Chunk*>& slot = chunks[id >> ChunkShift];
+            Chunk* chunk = slot.load(std::memory_order_acquire);
+            if (!chunk)
+            {
+                Chunk* created = new Chunk();
+                if (slot.compare_exchange_strong(chunk, created, std::memory_order_acq_rel))
+                {
+                    chunk = created;
+                }
+                else
+                {
+                    delete created; // ߳Ѵchunk ѸΪ
+                }
+            }
+            return chunk;
+        }
+
+        int getEmptyStringId()
+        {
+            return getIdForString("");
         }
 
         int getIdForString(const char* str)
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            return getIdForString(std::string_view(str ? str : ""));
+        }
 
-            std::string s = str ? str : "";
+        int getIdForString(std::string_view str)
+        {
+            return getIdForString(str.data(), str.size(), StaticStringHash(str.data(), str.size()));
+        }
+
+        // hash Ϊ StaticStringHash(str, len)ڱ
+        // פַֻңڴ棻ַ´һε洢
+        int getIdForString(const char* str, size_t len, uint64_t hash)
+        {
+            Shard& shard = shards[shardIndex(hash)];
+            std::lock_guard<std::mutex> lock(shard.mutex);
 
-            auto it = stringToId.find(s);
-            if (it != stringToId.end())
+            PoolKey key{ std::string_view(str, len), hash };
+            auto it = shard.stringToId.find(key);
+            if (it != shard.stringToId.end())
             {
                 return it->second;
             }
 
-            // ַID
-            int newId = nextId++;
-            stringToId[s] = newId;
-            idToString.push_back(s);
+            // ıʱʱ̶Ϊַ֤ͬһıֻһID
+            if (transient.liveCount.load(std::memory_order_relaxed) > 0)
+            {
+                std::lock_guard<std::mutex> transientLock(transient.mutex);
+                auto transientIt = transient.textToId.find(key);
+                if (transientIt != transient.textToId.end())
+                {
+                    int id = transientIt->second;
+                    TransientSlot& slot = transient.slot(id);
+                    slot.pinned.store(true, std::memory_order_release);
+                    transient.pinnedCount++;
+                    totalBytes.fetch_add(len, std::memory_order_relaxed);
+                    shard.stringToId.emplace(PoolKey{ std::string_view(slot.text), hash }, id);
+                    return id;
+                }
+            }
+
+            return insertLocked(shard, str, len, hash);
+        }
+
+        // µIDchunks Ϊ飬IDþʱ׳쳣Խд
+        int allocateId()
+        {
+            int id = nextId.load(std::memory_order_relaxed);
+            do
+            {
+                if (id >= MaxChunks * ChunkSize)
+                {
+                    throw std::runtime_error("StaticString pool is full");
+                }
+            } while (!nextId.compare_exchange_weak(id, id + 1, std::memory_order_relaxed));
+            return id;
+        }
+
+        // ÷ shard.mutex
+        int insertLocked(Shard& shard, const char* str, size_t len, uint64_t hash)
+        {
+            // ַIDд洢Ųӳ䣬߳õIDʱѾ
+            // ӳļarenaеַarenaֻ׷ӲƶͼʧЧ
+            int newId = allocateId();
+            Entry& entry = getOrCreateChunk(newId)->entries[newId & (ChunkSize - 1)];
+            entry.data = shard.arena.store(str, len);
+            entry.size = len;
+            totalBytes.fetch_add(len, std::memory_order_relaxed);
+            shard.stringToId.emplace(PoolKey{ std::string_view(entry.data, len), hash }, newId);
             return newId;
         }
 
-        const std::string& getStringById(int id)
+        // ȫƬڼ䲻µID
+        struct AllShardsLock
+        {
+            Shard* shards;
+
+            explicit AllShardsLock(Shard* s) : shards(s)
+            {
+                for (size_t i = 0; i < ShardCount; ++i)
+                {
+                    shards[i].mutex.lock();
+                }
+            }
+
+            ~AllShardsLock()
+            {
+                for (size_t i = ShardCount; i > 0; --i)
+                {
+                    shards[i - 1].mutex.unlock();
+                }
+            }
+        };
+
+        // ־ûļʽֽ򣩣
+        // ħ"SSPL" | 汾 uint32 | ַN uint32 | ̶ַP uint32 | ƫƱ uint32[N+P+1] | ַ
+        // iַΪַ[offsets[i], offsets[i+1])ǰNIDΪi
+        // ֮Pڼ䱻פ̶ַʱʹʱIDʱηID֮IDȶ
+        static constexpr char FileMagic[4] = { 'S', 'S', 'P', 'L' };
+        static constexpr uint32_t FileVersion = 2;
+
+        bool save(const std::string& filePath)
+        {
+            std::vector<uint32_t> offsets;
+            std::string blob;
+            uint32_t count = 0;
+            {
+                AllShardsLock lock(shards);
+                count = static_cast<uint32_t>(nextId.load(std::memory_order_acquire));
+                offsets.reserve(count + 1);
+                blob.reserve(totalBytes.load(std::memory_order_relaxed));
+                for (uint32_t id = 0; id < count; ++id)
+                {
+                    offsets.push_back(static_cast<uint32_t>(blob.size()));
+                    blob += getViewById(static_cast<int>(id));
+                }
+
+                std::lock_guard<std::mutex> transientLock(transient.mutex);
+                for (int index = 0; index < transient.nextSlot; ++index)
+                {
+                    const TransientSlot& slot = transient.slot(index);
+                    if (slot.pinned.load(std::memory_order_relaxed))
+                    {
+                        offsets.push_back(static_cast<uint32_t>(blob.size()));
+                        blob += slot.text;
+                    }
+                }
+                offsets.push_back(static_cast<uint32_t>(blob.size()));
+            }
+
+            std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+            if (!file)
+            {
+                return false;
+            }
+            uint32_t pinnedCount = static_cast<uint32_t>(offsets.size() - 1) - count;
+            file.write(FileMagic, sizeof(FileMagic));
+            file.write(reinterpret_cast<const char*>(&FileVersion), sizeof(FileVersion));
+            file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+            file.write(reinterpret_cast<const char*>(&pinnedCount), sizeof(pinnedCount));
+            file.write(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(uint32_t));
+            file.write(blob.data(), blob.size());
+            return static_cast<bool>(file);
+        }
+
+        // ıǷڳУáѹ̶ʱУ÷ȫƬʱ
+        bool containsTextLocked(std::string_view text, uint64_t hash) const
+        {
+            PoolKey key{ text, hash };
+            return shards[shardIndex(hash)].stringToId.count(key) != 0 || transient.textToId.count(key) != 0;
+        }
+
+        bool load(const std::string& filePath)
+        {
+            std::ifstream file(filePath, std::ios::binary);
+            if (!file)
+            {
+                return false;
+            }
+            std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+            // УļͷƫƱ
+            const size_t headerSize = sizeof(FileMagic) + 3 * sizeof(uint32_t);
+            if (content.size() < headerSize
+                || content.compare(0, sizeof(FileMagic), FileMagic, sizeof(FileMagic)) != 0)
+            {
+                return false;
+            }
+            uint32_t version = 0;
+            uint32_t count = 0;
+            uint32_t pinnedCount = 0;
+            std::memcpy(&version, content.data() + sizeof(FileMagic), sizeof(version));
+            std::memcpy(&count, content.data() + sizeof(FileMagic) + sizeof(version), sizeof(count));
+            std::memcpy(&pinnedCount, content.data() + sizeof(FileMagic) + 2 * sizeof(uint32_t), sizeof(pinnedCount));
+            if (version != FileVersion)
+            {
+                return false;
+            }
+            const uint64_t total = static_cast<uint64_t>(count) + pinnedCount;
+            if (total >= static_cast<uint64_t>(MaxChunks) * ChunkSize
+                || (content.size() - headerSize) / sizeof(uint32_t) < total + 1)
+            {
+                return false;
+            }
+            std::vector<uint32_t> offsets(static_cast<size_t>(total) + 1);
+            std::memcpy(offsets.data(), content.data() + headerSize, offsets.size() * sizeof(uint32_t));
+            const char* blob = content.data() + headerSize + offsets.size() * sizeof(uint32_t);
+            size_t blobSize = content.size() - headerSize - offsets.size() * sizeof(uint32_t);
+            if (offsets.front() != 0 || offsets.back() != blobSize)
+            {
+                return false;
+            }
+            for (size_t i = 0; i < total; ++i)
+            {
+                if (offsets[i] > offsets[i + 1])
+                {
+                    return false;
+                }
+            }
+            auto fileString = [&](size_t i)
+                {
+                    return std::string_view(blob + offsets[i], offsets[i + 1] - offsets[i]);
+                };
+
+            AllShardsLock lock(shards);
+            std::lock_guard<std::mutex> transientLock(transient.mutex);
+            uint32_t existing = static_cast<uint32_t>(nextId.load(std::memory_order_acquire));
+            if (static_cast<uint64_t>(std::max(existing, count)) + pinnedCount > static_cast<uint64_t>(MaxChunks) * ChunkSize)
+            {
+                return false;
+            }
+
+            // IDļһ£ļַIDڣʱеı֤ͬһıֻһID
+            for (uint32_t id = 0; id < std::min(existing, count); ++id)
+            {
+                if (getViewById(static_cast<int>(id)) != fileString(id))
+                {
+                    return false;
+                }
+            }
+            for (uint32_t id = existing; id < count; ++id)
+            {
+                std::string_view text = fileString(id);
+                if (containsTextLocked(text, StaticStringHash(text.data(), text.size())))
+                {
+                    return false;
+                }
+            }
+
+            // д洢һԷnextId
+            // ̶ַûIDԼֻڵǰûиıʱ׷
+            if (total > existing)
+            {
+                for (auto& shard : shards)
+                {
+                    shard.stringToId.reserve(shard.stringToId.size() + static_cast<size_t>(total - existing) / ShardCount + 1);
+                }
+            }
+            int next = static_cast<int>(std::max(existing, count));
+            size_t addedBytes = 0;
+            auto append = [&](int id, std::string_view text, uint64_t hash)
+                {
+                    Shard& shard = shards[shardIndex(hash)];
+                    Entry& entry = getOrCreateChunk(id)->entries[id & (ChunkSize - 1)];
+                    entry.data = shard.arena.store(text.data(), text.size());
+                    entry.size = text.size();
+                    shard.stringToId.emplace(PoolKey{ std::string_view(entry.data, entry.size), hash }, id);
+                    addedBytes += text.size();
+                };
+            for (uint32_t id = existing; id < count; ++id)
+            {
+                std::string_view text = fileString(id);
+                append(static_cast<int>(id), text, StaticStringHash(text.data(), text.size()));
+            }
+            for (size_t i = count; i < total; ++i)
+            {
+                std::string_view text = fileString(i);
+                uint64_t hash = StaticStringHash(text.data(), text.size());
+                if (!containsTextLocked(text, hash))
+                {
+                    append(next++, text, hash);
+                }
+            }
+            totalBytes.fetch_add(addedBytes, std::memory_order_relaxed);
+            nextId.store(next, std::memory_order_release);
+            return true;
+        }
+
+        // ʱפפıֱӷID򷵻ʱIDһ
+        int acquireTransient(std::string_view str)
+        {
+            uint64_t hash = StaticStringHash(str.data(), str.size());
+            Shard& shard = shards[shardIndex(hash)];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+
+            PoolKey key{ str, hash };
+            auto it = shard.stringToId.find(key);
+            if (it != shard.stringToId.end())
+            {
+                return it->second;
+            }
+
+            std::lock_guard<std::mutex> transientLock(transient.mutex);
+            auto transientIt = transient.textToId.find(key);
+            if (transientIt != transient.textToId.end())
+            {
+                transient.slot(transientIt->second).refCount++;
+                return transientIt->second;
+            }
+
+            int index;
+            if (!transient.freeSlots.empty())
+            {
+                index = transient.freeSlots.back();
+                transient.freeSlots.pop_back();
+            }
+            else if (transient.nextSlot <= TransientSlotMask)
+            {
+                index = transient.nextSlot++;
+                std::atomic<TransientChunk*>& chunk = transient.chunks[index >> ChunkShift];
+                if (!chunk.load(std::memory_order_relaxed))
+                {
+                    chunk.store(new TransientChunk(), std::memory_order_release);
+                }
+            }
+            else
+            {
+                // ʱλľ˻Ϊפ
+                return insertLocked(shard, str.data(), str.size(), hash);
+            }
+
+            TransientSlot& slot = transient.slot(index);
+            int id = TransientFlag | (slot.generation << TransientSlotBits) | index;
+            slot.text.assign(str.data(), str.size());
+            slot.refCount = 1;
+            slot.pinned.store(false, std::memory_order_relaxed);
+            slot.id.store(id, std::memory_order_release);
+            transient.textToId.emplace(PoolKey{ std::string_view(slot.text), hash }, id);
+            transient.liveCount.fetch_add(1, std::memory_order_relaxed);
+            transient.liveBytes += str.size();
+            return id;
+        }
+
+        // ͷһʱãùδ̶ʱմ洢λ
+        void releaseTransient(int id)
         {
-            std::lock_guard<std::mutex> lock(mutex);
-            if (id >= 0 && id < static_cast<int>(idToString.size()))
+            std::lock_guard<std::mutex> transientLock(transient.mutex);
+            TransientSlot& slot = transient.slot(id);
+            if (slot.id.load(std::memory_order_relaxed) != id || --slot.refCount > 0)
             {
-                return idToString[id];
+                return;
+            }
+
+            transient.textToId.erase(PoolKey{ std::string_view(slot.text), StaticStringHash(slot.text.data(), slot.text.size()) });
+            transient.liveCount.fetch_sub(1, std::memory_order_relaxed);
+            transient.liveBytes -= slot.text.size();
+            if (slot.pinned.load(std::memory_order_relaxed))
+            {
+                return; // ַλ
+            }
+
+            slot.id.store(0, std::memory_order_release);
+            std::string().swap(slot.text);
+            slot.generation = (slot.generation + 1) & TransientGenerationMask;
+            transient.freeSlots.push_back(id & TransientSlotMask);
+        }
+
+        const TransientSlot* findTransientSlot(int id) const
+        {
+            int index = id & TransientSlotMask;
+            TransientChunk* chunk = transient.chunks[index >> ChunkShift].load(std::memory_order_acquire);
+            if (chunk)
+            {
+                const TransientSlot& slot = chunk->slots[index & (ChunkSize - 1)];
+                if (slot.id.load(std::memory_order_acquire) == id)
+                {
+                    return &slot;
+                }
+            }
+            return nullptr;
+        }
+
+        // ʱIDǷѱ̶Ϊַ
+        bool isPinnedId(int id) const
+        {
+            const TransientSlot* slot = findTransientSlot(id);
+            return slot && slot->pinned.load(std::memory_order_acquire);
+        }
+
+        const Entry* findEntry(int id) const
+        {
+            if (id >= 0 && id < nextId.load(std::memory_order_acquire))
+            {
+                Chunk* chunk = chunks[id >> ChunkShift].load(std::memory_order_acquire);
+                if (chunk)
+                {
+                    return &chunk->entries[id & (ChunkSize - 1)];
+                }
+            }
+            return nullptr;
+        }
+
+        // ȡַͼڳڱЧԿַβ
+        // ʱַͼڳڼЧ
+        std::string_view getViewById(int id) const
+        {
+            if (isTransientId(id))
+            {
+                if (const TransientSlot* slot = findTransientSlot(id))
+                {
+                    return std::string_view(slot->text);
+                }
+            }
+            else if (const Entry* entry = findEntry(id))
+            {
+                return std::string_view(entry->data, entry->size);
+            }
+            return std::string_view("");
+        }
+
+        // std::stringãַ״ηʱ߳̾ʱֻһ
+        const std::string& getStringById(int id) const
+        {
+            if (isTransientId(id))
+            {
+                if (const TransientSlot* slot = findTransientSlot(id))
+                {
+                    return slot->text;
+                }
+            }
+            else if (const Entry* entry = findEntry(id))
+            {
+                std::string* materialized = entry->materialized.load(std::memory_order_acquire);
+                if (!materialized)
+                {
+                    std::string* created = new std::string(entry->data, entry->size);
+                    if (entry->materialized.compare_exchange_strong(materialized, created, std::memory_order_acq_rel))
+                    {
+                        materialized = created;
+                        materializedBytes.fetch_add(entry->size, std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        delete created;
+                    }
+                }
+                return *materialized;
             }
             // ؿַΪĬֵ
             static const std::string empty = "";
@@ -187,10 +896,62 @@ private:
         return pool;
     }
 
+    // ֱ̱߳ӳ仺棺ַַͳȶλĿʱȥϣ
+    // ͬһַݿѸı䣬ǰеַֽڱȶȷ
+    static constexpr size_t ThreadCacheSize = 64;   // 2
+
+    struct ThreadCacheEntry
+    {
+        const char* data = nullptr;
+        size_t size = 0;
+        int id = 0;
+    };
+
+    struct ThreadCache
+    {
+        ThreadCacheEntry entries[ThreadCacheSize];
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+    };
+
+    static ThreadCache& getThreadCache()
+    {
+        thread_local ThreadCache cache;
+        return cache;
+    }
+
+    template<typename Resolve>
+    static int getCachedStringId(const char* str, size_t len, Resolve&& resolve)
+    {
+        ThreadCache& cache = getThreadCache();
+        uint64_t key = (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(str)) ^ (static_cast<uint64_t>(len) << 48)) * 0x9e3779b97f4a7c15ull;
+        ThreadCacheEntry& entry = cache.entries[key >> 58 & (ThreadCacheSize - 1)];
+        if (entry.data == str && entry.size == len && getViewById(entry.id) == std::string_view(str, len))
+        {
+            cache.hits++;
+            return entry.id;
+        }
+
+        cache.misses++;
+        int id = resolve();
+        entry.data = str;
+        entry.size = len;
+        entry.id = id;
+        return id;
+    }
+
     // 
     static int getStringId(const char* str)
     {
-        return getStringPool().getIdForString(str);
+        return getStringId(std::string_view(str ? str : ""));
+    }
+
+    static int getStringId(std::string_view str)
+    {
+        return getCachedStringId(str.data(), str.size(), [str]()
+            {
+                return getStringPool().getIdForString(str);
+            });
     }
 
     static int emptyStringId()
@@ -203,13 +964,153 @@ private:
         return getStringPool().getStringById(id);
     }
 
+    static std::string_view getViewById(int id)
+    {
+        return getStringPool().getViewById(id);
+    }
+
     friend std::ostream& operator<<(std::ostream& os, const StaticString& ss)
     {
-        os << ss.str();
+        os << ss.view();
         return os;
     }
 };
 
+// StaticStringƴַֻеcommit()ʱפַ
+// ѭймռַ
+class StaticStringBuilder
+{
+public:
+    static constexpr size_t InlineCapacity = 128;
+
+    StaticStringBuilder() = default;
+    explicit StaticStringBuilder(std::string_view initial) { append(initial); }
+
+    StaticStringBuilder(const StaticStringBuilder&) = delete;
+    StaticStringBuilder& operator=(const StaticStringBuilder&) = delete;
+
+    StaticStringBuilder& append(std::string_view str)
+    {
+        reserve(size_ + str.size());
+        if (!str.empty())
+        {
+            std::memcpy(data_ + size_, str.data(), str.size());
+            size_ += str.size();
+        }
+        return *this;
+    }
+
+    StaticStringBuilder& append(const char* str)
+    {
+        return append(std::string_view(str ? str : ""));
+    }
+
+    StaticStringBuilder& append(const std::string& str)
+    {
+        return append(std::string_view(str));
+    }
+
+    StaticStringBuilder& append(const StaticString& str)
+    {
+        return append(str.view());
+    }
+
+    StaticStringBuilder& append(char c)
+    {
+        reserve(size_ + 1);
+        data_[size_++] = c;
+        return *this;
+    }
+
+    // ׷ʮƱʾ
+    StaticStringBuilder& appendNumber(long long value)
+    {
+        char buffer[24];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        return append(std::string_view(buffer, static_cast<size_t>(result.ptr - buffer)));
+    }
+
+    StaticStringBuilder& operator+=(std::string_view str) { return append(str); }
+    StaticStringBuilder& operator+=(const char* str) { return append(str); }
+    StaticStringBuilder& operator+=(const std::string& str) { return append(str); }
+    StaticStringBuilder& operator+=(const StaticString& str) { return append(str); }
+    StaticStringBuilder& operator+=(char c) { return append(c); }
+
+    // ǰݣһ׷ǰЧ
+    std::string_view view() const { return std::string_view(data_, size_); }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    // ݣѷѭ
+    void clear() { size_ = 0; }
+
+    // ǰפַ
+    StaticString commit() const { return StaticString(view()); }
+
+private:
+    void reserve(size_t required)
+    {
+        if (required <= capacity_)
+        {
+            return;
+        }
+        size_t newCapacity = capacity_ * 2;
+        while (newCapacity < required)
+        {
+            newCapacity *= 2;
+        }
+        std::unique_ptr<char[]> grown(new char[newCapacity]);
+        std::memcpy(grown.get(), data_, size_);
+        heap_ = std::move(grown);
+        data_ = heap_.get();
+        capacity_ = newCapacity;
+    }
+
+    char inline_[InlineCapacity];
+    std::unique_ptr<char[]> heap_;      // Ķѻ
+    char* data_ = inline_;
+    size_t size_ = 0;
+    size_t capacity_ = InlineCapacity;
+};
+
+// ʱפפַգIDɱ
+// פıIDڼ䱻פıᱻ̶ٻ
+// 󲻵ʹפStaticStringȡõַ
+class StaticString::TransientScope
+{
+public:
+    TransientScope() = default;
+    ~TransientScope() { release(); }
+
+    TransientScope(const TransientScope&) = delete;
+    TransientScope& operator=(const TransientScope&) = delete;
+
+    StaticString intern(std::string_view str)
+    {
+        int id = getStringPool().acquireTransient(str);
+        if (StringPool::isTransientId(id) && !heldIds_.insert(id).second)
+        {
+            getStringPool().releaseTransient(id); // ѳиַ
+        }
+        return StaticString(IdTag{}, id);
+    }
+
+    // ǰͷűеȫʱַ
+    void release()
+    {
+        for (int id : heldIds_)
+        {
+            getStringPool().releaseTransient(id);
+        }
+        heldIds_.clear();
+    }
+
+    size_t size() const { return heldIds_.size(); }
+
+private:
+    std::unordered_set<int> heldIds_;
+};
+
 // ΪStaticStringṩstd::hashػ
 namespace std
 {
@@ -230,4 +1131,8 @@ struct StaticStringCompare
     {
         return lhs < rhs;
     }
-};
\ No newline at end of file
+};
+
+// ڵõ㻺ӦStaticString״ִʱפֻ֮Ƕȡھ̬
+#define STATIC_STRING(literal) \
+    ([]() -> const StaticString& { static const StaticString cached(literal##_ss); return cached; }())
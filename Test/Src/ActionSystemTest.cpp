@@ -879,3 +879,85 @@ TEST_CASE("向后兼容性测试", "[ActionSystem][Compatibility]")
         REQUIRE(enumSystem.HasAction(100) == true);
     }
 }
+
+TEST_CASE("冻结动作键集合测试", "[ActionSystem][Freeze]")
+{
+    SECTION("不允许重载模式")
+    {
+        StringActionSystem system;
+        int total = 0;
+        for (int i = 0; i < 50; ++i)
+        {
+            system.AddSequentialProcessor("frozen_action_" + std::to_string(i),
+                [&total, i](int x) { total += x + i; }, "处理器");
+        }
+
+        REQUIRE(system.Freeze());
+        REQUIRE(system.IsFrozen());
+        REQUIRE(system.Execute("frozen_action_7", 1).success);
+        REQUIRE(total == 8);
+        REQUIRE_FALSE(system.Execute("frozen_missing", 1).success);
+        REQUIRE_FALSE(system.Execute("frozen_action_7", 1.5f).success);
+
+        // 已有动作键添加处理器保持冻结
+        system.AddSequentialProcessor("frozen_action_7", [&total](int x) { total += x * 100; }, "追加处理器");
+        REQUIRE(system.IsFrozen());
+        system.Execute("frozen_action_7", 1);
+        REQUIRE(total == 116);
+
+        // 新动作键自动解冻
+        system.AddSequentialProcessor("frozen_new_action", [&total](int x) { total = x; }, "新处理器");
+        REQUIRE_FALSE(system.IsFrozen());
+        REQUIRE(system.Execute("frozen_new_action", 5).success);
+        REQUIRE(total == 5);
+
+        REQUIRE(system.Freeze());
+        system.Clear();
+        REQUIRE_FALSE(system.IsFrozen());
+    }
+
+    SECTION("允许重载模式")
+    {
+        StringActionSystemOverload system;
+        int intCalls = 0;
+        int floatCalls = 0;
+        system.AddSequentialProcessor("frozen_overload", [&](int) { intCalls++; }, "int处理器");
+        system.AddSequentialProcessor("frozen_overload", [&](float) { floatCalls++; }, "float处理器");
+
+        REQUIRE(system.Freeze());
+        REQUIRE(system.Execute("frozen_overload", 1).success);
+        REQUIRE(system.Execute("frozen_overload", 1.0f).success);
+        REQUIRE(intCalls == 1);
+        REQUIRE(floatCalls == 1);
+
+        // 已有动作键添加新的参数重载保持冻结
+        bool stringCalled = false;
+        system.AddSequentialProcessor("frozen_overload", [&](const std::string&) { stringCalled = true; }, "string处理器");
+        REQUIRE(system.IsFrozen());
+        REQUIRE(system.Execute("frozen_overload", std::string("x")).success);
+        REQUIRE(stringCalled);
+    }
+
+    SECTION("冻结后增删参数重载时缓存的匹配结果失效")
+    {
+        StringActionSystemOverload system;
+        int intCalls = 0;
+        auto intHandle = system.AddSequentialProcessor("frozen_cached", [&](int) { intCalls++; }, "int处理器");
+        REQUIRE(system.Freeze());
+
+        // 尚无double重载，执行失败的结果也会被缓存
+        REQUIRE_FALSE(system.Execute("frozen_cached", 1.0).success);
+        bool doubleCalled = false;
+        system.AddSequentialProcessor("frozen_cached", [&](double) { doubleCalled = true; }, "double处理器");
+        REQUIRE(system.IsFrozen());
+        REQUIRE(system.Execute("frozen_cached", 1.0).success);
+        REQUIRE(doubleCalled);
+
+        // int重载的包装器随最后一个处理器移除，缓存不得再指向它
+        REQUIRE(system.Execute("frozen_cached", 1).success);
+        REQUIRE(system.RemoveHandler(intHandle));
+        REQUIRE(system.IsFrozen());
+        REQUIRE_FALSE(system.Execute("frozen_cached", 1).success);
+        REQUIRE(intCalls == 1);
+    }
+}
@@ -0,0 +1,751 @@
+﻿#include <catch2/catch_test_macros.hpp>
+#include <EditorKit/KDataBus.h>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <stdexcept>
+#include <ostream>
+
+namespace
+{
+    struct ToolService
+    {
+        int value = 0;
+    };
+
+    struct RenderService
+    {
+        int frame = 0;
+    };
+
+    // 记录析构次数的对象
+    struct TrackedValue
+    {
+        int value;
+        int* destroyed;
+
+        TrackedValue(int v, int* counter) : value(v), destroyed(counter) {}
+        ~TrackedValue() { (*destroyed)++; }
+    };
+
+    // 每个字段都写入帧号，用于检测读到写入一半的帧
+    struct FrameData
+    {
+        int frame = 0;
+        std::vector<int> samples;
+    };
+
+    struct alignas(64) AlignedValue
+    {
+        float data[16];
+    };
+
+    // 复制时可按需抛出异常的键，用于模拟数据项插入映射表失败
+    struct ThrowingKey
+    {
+        static inline bool throwOnCopy = false;
+        std::string name;
+
+        ThrowingKey(const char* n) : name(n) {}
+        ThrowingKey(const ThrowingKey& other) : name(other.name)
+        {
+            if (throwOnCopy) throw std::runtime_error("key copy failed");
+        }
+        ThrowingKey& operator=(const ThrowingKey&) = default;
+
+        bool operator==(const ThrowingKey& other) const { return name == other.name; }
+        friend std::ostream& operator<<(std::ostream& os, const ThrowingKey& key) { return os << key.name; }
+    };
+
+    struct ThrowingKeyHash
+    {
+        size_t operator()(const ThrowingKey& key) const { return std::hash<std::string>()(key.name); }
+    };
+
+    // 静默错误输出，避免测试日志被注册/注销信息淹没
+    template<typename Bus>
+    void SilenceBus(Bus& bus)
+    {
+        bus.SetErrorHandler([](const char*) {});
+    }
+}
+
+TEST_CASE("DataBus 类型化句柄", "[DataBus][Handle]")
+{
+    DataBus<std::string> bus;
+    SilenceBus(bus);
+    ToolService service{ 7 };
+    REQUIRE(bus.RegisterData("tool", &service).success);
+
+    SECTION("获取时校验键与类型")
+    {
+        auto handle = bus.GetHandle<ToolService>("tool");
+        REQUIRE(handle);
+        REQUIRE(handle.Get() == &service);
+        REQUIRE(handle->value == 7);
+
+        REQUIRE_FALSE(bus.GetHandle<int>("tool"));
+        REQUIRE_FALSE(bus.GetHandle<ToolService>("missing"));
+        REQUIRE(DataBus<std::string>::Handle<ToolService>().Get() == nullptr);
+    }
+
+    SECTION("注销后句柄失效，槽位复用不会让旧句柄复活")
+    {
+        auto handle = bus.GetHandle<ToolService>("tool");
+        REQUIRE(bus.UnregisterData("tool"));
+        REQUIRE_FALSE(handle.IsValid());
+
+        ToolService other{ 9 };
+        REQUIRE(bus.RegisterData("tool", &other).success);
+        REQUIRE(handle.Get() == nullptr);
+        REQUIRE(bus.GetHandle<ToolService>("tool")->value == 9);
+    }
+
+    SECTION("清空后所有句柄失效")
+    {
+        int number = 3;
+        bus.RegisterData("number", &number);
+        auto toolHandle = bus.GetHandle<ToolService>("tool");
+        auto numberHandle = bus.GetHandle<int>("number");
+        REQUIRE(*numberHandle == 3);
+
+        bus.Clear();
+        REQUIRE_FALSE(toolHandle);
+        REQUIRE_FALSE(numberHandle);
+    }
+
+    SECTION("大量注册后句柄地址保持稳定")
+    {
+        auto handle = bus.GetHandle<ToolService>("tool");
+        std::vector<int> values(1000);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            bus.RegisterData("item_" + std::to_string(i), &values[i]);
+        }
+        REQUIRE(handle.Get() == &service);
+    }
+}
+
+TEST_CASE("DataBus 分级诊断输出", "[DataBus][Log]")
+{
+    DataBus<std::string> bus;
+    std::vector<std::pair<DataBusLogLevel, std::string>> messages;
+    bus.SetLogHandler([&](DataBusLogLevel level, const char* message)
+        {
+            messages.emplace_back(level, message);
+        });
+
+    SECTION("默认阈值下成功操作不产生诊断")
+    {
+        REQUIRE(bus.GetLogLevel() == DataBusLogLevel::Warning);
+        std::vector<int> values(1000);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            bus.RegisterData("bulk_" + std::to_string(i), &values[i]);
+        }
+        REQUIRE(bus.UnregisterData("bulk_0"));
+        bus.Clear();
+        REQUIRE(messages.empty());
+    }
+
+    SECTION("失败操作按级别输出")
+    {
+        int value = 1;
+        bus.RegisterData("value", &value);
+        bus.RegisterData("value", &value);
+        REQUIRE(bus.GetDataSafe<float>("value") == nullptr);
+        REQUIRE(bus.GetDataSafe<int>("missing") == nullptr);
+
+        REQUIRE(messages.size() == 3);
+        REQUIRE(messages[0].first == DataBusLogLevel::Error);
+        REQUIRE(messages[1].first == DataBusLogLevel::Error);
+        REQUIRE(messages[2].first == DataBusLogLevel::Warning);
+        REQUIRE(messages[2].second.find("missing") != std::string::npos);
+    }
+
+    SECTION("调整运行时阈值")
+    {
+        int value = 1;
+        bus.SetLogLevel(DataBusLogLevel::Info);
+        REQUIRE(bus.IsLogEnabled(DataBusLogLevel::Info));
+        bus.RegisterData("value", &value);
+        REQUIRE(messages.size() == 1);
+        REQUIRE(messages[0].first == DataBusLogLevel::Info);
+
+        bus.SetLogLevel(DataBusLogLevel::None);
+        REQUIRE_FALSE(bus.IsLogEnabled(DataBusLogLevel::Error));
+        bus.RegisterData("value", &value);
+        REQUIRE(bus.GetDataSafe<int>("missing") == nullptr);
+        REQUIRE(messages.size() == 1);
+    }
+
+    SECTION("SetErrorHandler兼容旧接口")
+    {
+        std::vector<std::string> legacy;
+        bus.SetErrorHandler([&](const char* message) { legacy.emplace_back(message); });
+        bus.UnregisterData("missing");
+        REQUIRE(legacy.size() == 1);
+        REQUIRE(messages.empty());
+    }
+}
+
+TEST_CASE("ConcurrentDataBus 无锁读取", "[DataBus][Concurrency]")
+{
+    ConcurrentDataBus<std::string> bus;
+
+    SECTION("基本注册与读取")
+    {
+        ToolService service{ 5 };
+        REQUIRE(bus.RegisterData("tool", &service));
+        REQUIRE_FALSE(bus.RegisterData("tool", &service));
+        REQUIRE_FALSE(bus.RegisterData<ToolService>("null", nullptr));
+
+        REQUIRE(bus.GetDataSafe<ToolService>("tool") == &service);
+        REQUIRE(bus.GetDataSafe<int>("tool") == nullptr);
+        REQUIRE(bus.CheckDataType<ToolService>("tool"));
+        REQUIRE(bus.GetDataCount() == 1);
+        REQUIRE(bus.GetAllKeys() == std::vector<std::string>{ "tool" });
+
+        REQUIRE(bus.UnregisterData("tool"));
+        REQUIRE_FALSE(bus.UnregisterData("tool"));
+        REQUIRE_FALSE(bus.HasData("tool"));
+    }
+
+    SECTION("读线程与写线程并发")
+    {
+        ToolService stable{ 1 };
+        bus.RegisterData("stable", &stable);
+        std::vector<ToolService> transient(200);
+
+        std::atomic<bool> stop{ false };
+        std::atomic<int> inconsistent{ 0 };
+        std::atomic<long long> reads{ 0 };
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 4; ++t)
+        {
+            readers.emplace_back([&]()
+                {
+                    while (!stop.load())
+                    {
+                        if (bus.GetDataSafe<ToolService>("stable") != &stable)
+                        {
+                            inconsistent++;
+                        }
+                        ToolService* item = bus.GetDataSafe<ToolService>("transient_7");
+                        if (item && item != &transient[7])
+                        {
+                            inconsistent++;
+                        }
+                        reads++;
+                    }
+                });
+        }
+
+        for (int round = 0; round < 5; ++round)
+        {
+            for (size_t i = 0; i < transient.size(); ++i)
+            {
+                bus.RegisterData("transient_" + std::to_string(i), &transient[i]);
+            }
+            for (size_t i = 0; i < transient.size(); ++i)
+            {
+                bus.UnregisterData("transient_" + std::to_string(i));
+            }
+        }
+        stop = true;
+        for (auto& reader : readers)
+        {
+            reader.join();
+        }
+
+        REQUIRE(inconsistent.load() == 0);
+        REQUIRE(reads.load() > 0);
+        REQUIRE(bus.GetDataCount() == 1);
+        bus.Clear();
+        REQUIRE(bus.GetDataCount() == 0);
+    }
+    SECTION("多读者多写者压力测试")
+    {
+        // 多个写者交替发布新表，读者遍历整张表；读者持有的表若被提前释放，遍历会访问已释放的内存
+        constexpr int WriterCount = 3;
+        constexpr int KeysPerWriter = 32;
+        std::vector<std::vector<ToolService>> items(WriterCount, std::vector<ToolService>(KeysPerWriter));
+        for (int w = 0; w < WriterCount; ++w)
+        {
+            for (int i = 0; i < KeysPerWriter; ++i)
+            {
+                items[w][i].value = w * KeysPerWriter + i;
+            }
+        }
+
+        std::atomic<bool> stop{ false };
+        std::atomic<int> inconsistent{ 0 };
+        std::atomic<long long> reads{ 0 };
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 4; ++t)
+        {
+            readers.emplace_back([&, t]()
+                {
+                    while (!stop.load())
+                    {
+                        for (const auto& key : bus.GetAllKeys())
+                        {
+                            if (key.compare(0, 2, "w_") != 0)
+                            {
+                                inconsistent++;
+                            }
+                        }
+                        int w = t % WriterCount;
+                        int i = static_cast<int>(reads.load() % KeysPerWriter);
+                        ToolService* item = bus.GetDataSafe<ToolService>("w_" + std::to_string(w) + "_" + std::to_string(i));
+                        if (item && item->value != w * KeysPerWriter + i)
+                        {
+                            inconsistent++;
+                        }
+                        reads++;
+                    }
+                });
+        }
+
+        std::vector<std::thread> writers;
+        for (int w = 0; w < WriterCount; ++w)
+        {
+            writers.emplace_back([&, w]()
+                {
+                    for (int round = 0; round < 20; ++round)
+                    {
+                        for (int i = 0; i < KeysPerWriter; ++i)
+                        {
+                            bus.RegisterData("w_" + std::to_string(w) + "_" + std::to_string(i), &items[w][i]);
+                        }
+                        for (int i = 0; i < KeysPerWriter; ++i)
+                        {
+                            bus.UnregisterData("w_" + std::to_string(w) + "_" + std::to_string(i));
+                        }
+                    }
+                });
+        }
+        for (auto& writer : writers)
+        {
+            writer.join();
+        }
+        stop = true;
+        for (auto& reader : readers)
+        {
+            reader.join();
+        }
+
+        REQUIRE(inconsistent.load() == 0);
+        REQUIRE(reads.load() > 0);
+        REQUIRE(bus.GetDataCount() == 0);
+    }
+}
+
+TEST_CASE("DataBus 变更通知与版本", "[DataBus][Version]")
+{
+    DataBus<std::string> bus;
+    SilenceBus(bus);
+    ToolService a{ 1 };
+    ToolService b{ 2 };
+    ToolService c{ 3 };
+    bus.RegisterData("a", &a);
+    bus.RegisterData("b", &b);
+    uint64_t baseline = bus.GetVersion();
+    bus.RegisterData("c", &c);
+
+    SECTION("ChangedSince只枚举之后的变更")
+    {
+        REQUIRE(bus.ChangedSince(baseline) == std::vector<std::string>{ "c" });
+        REQUIRE(bus.MarkChanged("a"));
+        REQUIRE(bus.ChangedSince(baseline) == std::vector<std::string>{ "c", "a" });
+        REQUIRE(bus.ChangedSince(bus.GetVersion()).empty());
+        REQUIRE(bus.GetDataVersion("a") == bus.GetVersion());
+        REQUIRE(bus.GetDataVersion("b") < baseline + 1);
+
+        REQUIRE_FALSE(bus.MarkChanged("missing"));
+        bus.UnregisterData("c");
+        REQUIRE(bus.ChangedSince(baseline) == std::vector<std::string>{ "a" });
+        REQUIRE(bus.GetDataVersion("c") == 0);
+    }
+
+    SECTION("观察者接收对应键的变更")
+    {
+        std::vector<std::string> keyEvents;
+        std::vector<std::string> allEvents;
+        uint64_t lastVersion = 0;
+        uint64_t keyObserver = bus.AddObserver("a", [&](const std::string& key, uint64_t version)
+            {
+                keyEvents.push_back(key);
+                lastVersion = version;
+            });
+        bus.AddGlobalObserver([&](const std::string& key, uint64_t) { allEvents.push_back(key); });
+
+        bus.MarkChanged("a");
+        bus.MarkChanged("b");
+        REQUIRE(keyEvents == std::vector<std::string>{ "a" });
+        REQUIRE(lastVersion == bus.GetDataVersion("a"));
+        REQUIRE(allEvents == std::vector<std::string>{ "a", "b" });
+
+        REQUIRE(bus.RemoveObserver(keyObserver));
+        REQUIRE_FALSE(bus.RemoveObserver(keyObserver));
+        bus.MarkChanged("a");
+        REQUIRE(keyEvents.size() == 1);
+        REQUIRE(allEvents.size() == 3);
+    }
+
+    SECTION("注销与清空以版本号0通知观察者")
+    {
+        std::vector<std::pair<std::string, uint64_t>> events;
+        bus.AddObserver("a", [&](const std::string& key, uint64_t version)
+            {
+                events.emplace_back(key, version);
+                REQUIRE((version != 0) == bus.HasData(key));
+            });
+        std::vector<std::string> removed;
+        bus.AddGlobalObserver([&](const std::string& key, uint64_t version)
+            {
+                if (version == 0) removed.push_back(key);
+            });
+
+        REQUIRE(bus.UnregisterData("a"));
+        REQUIRE_FALSE(bus.UnregisterData("a"));
+        REQUIRE(events == std::vector<std::pair<std::string, uint64_t>>{ { "a", 0 } });
+        REQUIRE(removed == std::vector<std::string>{ "a" });
+
+        bus.Clear();
+        std::sort(removed.begin(), removed.end());
+        REQUIRE(removed == std::vector<std::string>{ "a", "b", "c" });
+        REQUIRE(events.size() == 1);
+    }
+
+    SECTION("清空后没有变更记录")
+    {
+        bus.Clear();
+        REQUIRE(bus.ChangedSince(0).empty());
+    }
+}
+
+TEST_CASE("DataBus 就地构造持有对象", "[DataBus][Emplace]")
+{
+    DataBus<std::string> bus;
+    SilenceBus(bus);
+    int destroyed = 0;
+
+    SECTION("注销时析构")
+    {
+        REQUIRE(bus.Emplace<TrackedValue>("tracked", 42, &destroyed).success);
+        REQUIRE(bus.GetDataSafe<TrackedValue>("tracked")->value == 42);
+        REQUIRE_FALSE(bus.Emplace<TrackedValue>("tracked", 1, &destroyed).success);
+        REQUIRE(destroyed == 0);
+
+        REQUIRE(bus.UnregisterData("tracked"));
+        REQUIRE(destroyed == 1);
+    }
+
+    SECTION("清空与销毁总线时析构")
+    {
+        {
+            DataBus<std::string> local;
+            SilenceBus(local);
+            local.Emplace<TrackedValue>("a", 1, &destroyed);
+            local.Emplace<TrackedValue>("b", 2, &destroyed);
+            local.Clear();
+            REQUIRE(destroyed == 2);
+            local.Emplace<TrackedValue>("c", 3, &destroyed);
+        }
+        REQUIRE(destroyed == 3);
+    }
+
+    SECTION("观察者收到通知时对象已由总线持有")
+    {
+        int seenValue = 0;
+        bus.AddObserver("observed", [&](const std::string& key, uint64_t version)
+            {
+                if (version == 0) return; // 下面的注销也会通知
+                TrackedValue* value = bus.GetDataSafe<TrackedValue>(key);
+                seenValue = value ? value->value : -1;
+                bus.UnregisterData(key);
+            });
+
+        REQUIRE(bus.Emplace<TrackedValue>("observed", 7, &destroyed).success);
+        REQUIRE(seenValue == 7);
+        REQUIRE(destroyed == 1);
+        REQUIRE_FALSE(bus.HasData("observed"));
+    }
+
+    SECTION("插入失败时析构已构造的对象")
+    {
+        DataBus<ThrowingKey, ThrowingKeyHash> keyBus;
+        SilenceBus(keyBus);
+        ThrowingKey::throwOnCopy = true;
+        bool threw = false;
+        try
+        {
+            keyBus.Emplace<TrackedValue>("failing", 1, &destroyed);
+        }
+        catch (const std::runtime_error&)
+        {
+            threw = true;
+        }
+        ThrowingKey::throwOnCopy = false;
+
+        REQUIRE(threw);
+        REQUIRE(destroyed == 1);
+        REQUIRE(keyBus.GetDataCount() == 0);
+        REQUIRE(keyBus.Emplace<TrackedValue>("failing", 2, &destroyed).success);
+        REQUIRE(keyBus.GetHandle<TrackedValue>("failing")->value == 2);
+    }
+
+    SECTION("观察者抛出异常时对象仍由总线持有")
+    {
+        bus.AddObserver("throwing", [](const std::string&, uint64_t version)
+            {
+                if (version != 0) throw std::runtime_error("observer failed");
+            });
+        REQUIRE_THROWS_AS(bus.Emplace<TrackedValue>("throwing", 3, &destroyed), std::runtime_error);
+        REQUIRE(destroyed == 0);
+        REQUIRE(bus.GetDataSafe<TrackedValue>("throwing")->value == 3);
+        REQUIRE(bus.UnregisterData("throwing"));
+        REQUIRE(destroyed == 1);
+    }
+
+    SECTION("满足对齐要求")
+    {
+        REQUIRE(bus.Emplace<AlignedValue>("aligned").success);
+        auto* aligned = bus.GetDataSafe<AlignedValue>("aligned");
+        REQUIRE(reinterpret_cast<uintptr_t>(aligned) % alignof(AlignedValue) == 0);
+        REQUIRE(bus.Emplace<std::string>("text", "owned string").success);
+        REQUIRE(*bus.GetDataSafe<std::string>("text") == "owned string");
+    }
+
+    SECTION("小对象连续存放并复用释放的空间")
+    {
+        bus.Emplace<int>("first", 1);
+        bus.Emplace<int>("second", 2);
+        auto* first = bus.GetDataSafe<int>("first");
+        auto* second = bus.GetDataSafe<int>("second");
+        REQUIRE(reinterpret_cast<char*>(second) - reinterpret_cast<char*>(first) == static_cast<std::ptrdiff_t>(DataBusArena::Granularity));
+
+        bus.UnregisterData("first");
+        bus.Emplace<int>("third", 3);
+        REQUIRE(bus.GetDataSafe<int>("third") == first);
+    }
+}
+
+TEST_CASE("DataBus 三缓冲生产者/消费者数据", "[DataBus][TripleBuffer]")
+{
+    DataBus<std::string> bus;
+    SilenceBus(bus);
+
+    SECTION("获取最新提交的一帧")
+    {
+        REQUIRE(bus.RegisterTripleBuffer<int>("frame", -1));
+        REQUIRE(*bus.AcquireLatest<int>("frame") == -1);
+
+        REQUIRE(bus.Publish("frame", 1));
+        REQUIRE(bus.Publish("frame", 2));
+        REQUIRE(*bus.AcquireLatest<int>("frame") == 2);
+        REQUIRE(*bus.AcquireLatest<int>("frame") == 2);
+
+        REQUIRE_FALSE(bus.Publish("frame", 1.0));
+        REQUIRE_FALSE(bus.Publish("missing", 1));
+        REQUIRE(bus.AcquireLatest<float>("frame") == nullptr);
+    }
+
+    SECTION("复用后缓冲")
+    {
+        TripleBuffer<FrameData>* buffer = bus.RegisterTripleBuffer<FrameData>("draw");
+        REQUIRE(buffer);
+        REQUIRE_FALSE(buffer->HasNewData());
+
+        FrameData& back = buffer->WriteBuffer();
+        back.frame = 7;
+        back.samples.assign(3, 7);
+        buffer->Commit();
+
+        REQUIRE(buffer->HasNewData());
+        const FrameData* latest = bus.AcquireLatest<FrameData>("draw");
+        REQUIRE(latest->frame == 7);
+        REQUIRE(latest->samples.size() == 3);
+        REQUIRE_FALSE(buffer->HasNewData());
+    }
+
+    SECTION("并发发布时消费者总是看到完整的帧")
+    {
+        TripleBuffer<FrameData>* buffer = bus.RegisterTripleBuffer<FrameData>("stats");
+        const int frameCount = 20000;
+
+        std::thread producer([&]()
+            {
+                for (int frame = 1; frame <= frameCount; ++frame)
+                {
+                    FrameData& data = buffer->WriteBuffer();
+                    data.frame = frame;
+                    data.samples.assign(16, frame);
+                    buffer->Commit();
+                }
+            });
+
+        int lastFrame = 0;
+        bool consistent = true;
+        while (lastFrame < frameCount)
+        {
+            const FrameData* data = bus.AcquireLatest<FrameData>("stats");
+            for (int sample : data->samples)
+            {
+                consistent = consistent && sample == data->frame;
+            }
+            consistent = consistent && data->frame >= lastFrame;
+            lastFrame = data->frame;
+        }
+        producer.join();
+
+        REQUIRE(consistent);
+        REQUIRE(lastFrame == frameCount);
+    }
+}
+
+TEST_CASE("DataBus 按类型注册的服务", "[DataBus][Service]")
+{
+    DataBus<std::string> first;
+    DataBus<std::string> second;
+    ToolService tool{ 1 };
+    ToolService otherTool{ 2 };
+    RenderService render;
+
+    REQUIRE(first.Get<ToolService>() == nullptr);
+
+    first.Register(&tool);
+    second.Register(&otherTool);
+    first.Register(&render);
+
+    // 各实例互相独立
+    REQUIRE(first.Get<ToolService>() == &tool);
+    REQUIRE(second.Get<ToolService>() == &otherTool);
+    REQUIRE(first.Get<RenderService>() == &render);
+    REQUIRE(second.Get<RenderService>() == nullptr);
+
+    // 与按键注册的数据互不影响
+    REQUIRE(first.GetDataCount() == 0);
+    REQUIRE_FALSE(first.HasData("ToolService"));
+
+    first.Unregister<ToolService>();
+    REQUIRE(first.Get<ToolService>() == nullptr);
+    REQUIRE(first.Get<RenderService>() == &render);
+
+    // Clear只清空按键注册的数据，服务需显式清空
+    first.Clear();
+    REQUIRE(first.Get<RenderService>() == &render);
+    first.ClearServices();
+    REQUIRE(first.Get<RenderService>() == nullptr);
+    REQUIRE(second.Get<ToolService>() == &otherTool);
+}
+
+TEST_CASE("DataBus 层级作用域", "[DataBus][Scope]")
+{
+    DataBus<std::string> global;
+    SilenceBus(global);
+    DataBus<std::string> document(&global);
+    DataBus<std::string> viewport(&document);
+
+    ToolService globalTool{ 1 };
+    ToolService viewportTool{ 2 };
+    int zoom = 100;
+    global.RegisterData("tool", &globalTool);
+    global.RegisterData("zoom", &zoom);
+
+    REQUIRE(viewport.GetParent() == &document);
+    REQUIRE(global.GetParent() == nullptr);
+
+    SECTION("未覆盖的键回退到父作用域")
+    {
+        REQUIRE(viewport.GetDataSafe<ToolService>("tool") == &globalTool);
+        REQUIRE(viewport.GetData<int>("zoom").dataPtr == &zoom);
+        REQUIRE(viewport.HasData("zoom"));
+        REQUIRE_FALSE(viewport.HasLocalData("zoom"));
+        REQUIRE(viewport.CheckDataType<int>("zoom"));
+        REQUIRE(viewport.GetDataSafe<ToolService>("missing") == nullptr);
+    }
+
+    SECTION("子作用域覆盖父作用域")
+    {
+        REQUIRE(viewport.GetDataSafe<ToolService>("tool") == &globalTool);
+        viewport.RegisterData("tool", &viewportTool);
+        REQUIRE(viewport.GetDataSafe<ToolService>("tool") == &viewportTool);
+        REQUIRE(document.GetDataSafe<ToolService>("tool") == &globalTool);
+
+        viewport.UnregisterData("tool");
+        REQUIRE(viewport.GetDataSafe<ToolService>("tool") == &globalTool);
+    }
+
+    SECTION("父作用域变化使缓存失效")
+    {
+        int pan = 5;
+        REQUIRE(viewport.GetDataSafe<int>("pan") == nullptr);
+        document.RegisterData("pan", &pan);
+        REQUIRE(viewport.GetDataSafe<int>("pan") == &pan);
+
+        REQUIRE(viewport.GetDataSafe<int>("zoom") == &zoom);
+        global.UnregisterData("zoom");
+        REQUIRE(viewport.GetDataSafe<int>("zoom") == nullptr);
+    }
+
+    SECTION("按类型注册的服务回退到父作用域")
+    {
+        RenderService globalRender;
+        RenderService viewportRender;
+        REQUIRE(viewport.Get<RenderService>() == nullptr);
+
+        global.Register(&globalRender);
+        REQUIRE(viewport.Get<RenderService>() == &globalRender);
+
+        viewport.Register(&viewportRender);
+        REQUIRE(viewport.Get<RenderService>() == &viewportRender);
+        REQUIRE(document.Get<RenderService>() == &globalRender);
+
+        viewport.Unregister<RenderService>();
+        REQUIRE(viewport.Get<RenderService>() == &globalRender);
+        global.ClearServices();
+        REQUIRE(viewport.Get<RenderService>() == nullptr);
+    }
+
+    SECTION("父作用域数据项的句柄")
+    {
+        auto handle = viewport.GetHandle<ToolService>("tool");
+        REQUIRE(handle.Get() == &globalTool);
+        global.UnregisterData("tool");
+        REQUIRE_FALSE(handle.IsValid());
+    }
+
+    SECTION("子作用域中生产者与消费者在两个线程按键访问三缓冲")
+    {
+        REQUIRE(global.RegisterTripleBuffer<int>("frames", 0));
+        const int frameCount = 20000;
+        bool published = true;
+
+        std::thread producer([&]()
+            {
+                for (int frame = 1; frame <= frameCount; ++frame)
+                {
+                    published = viewport.Publish("frames", frame) && published;
+                }
+            });
+
+        int lastFrame = 0;
+        bool ordered = true;
+        while (lastFrame < frameCount)
+        {
+            const int* frame = viewport.AcquireLatest<int>("frames");
+            ordered = ordered && frame && *frame >= lastFrame;
+            if (!frame) break;
+            lastFrame = *frame;
+        }
+        producer.join();
+
+        REQUIRE(published);
+        REQUIRE(ordered);
+        REQUIRE(lastFrame == frameCount);
+    }
+}
@@ -5,6 +5,7 @@
 #include <thread>
 #include <chrono>
 #include <atomic>
+#include <vector>
 
 // 测试用事件类型
 enum class TestEventType {
@@ -467,6 +468,126 @@ TEST_CASE("EventBus 边界情况测试", "[EventBus]") {
     
 }
 
+TEST_CASE("EventBus 冻结键集合测试", "[EventBus][Freeze]") {
+    EventBus<std::string> bus;
+    int multicastSum = 0;
+    std::string unicastMessage;
+
+    for (int i = 0; i < 100; ++i) {
+        bus.Subscribe("frozen_event_" + std::to_string(i), [&multicastSum, i](int value) {
+            multicastSum += value + i;
+        });
+    }
+    bus.SubscribeUnicast("frozen_unicast", [&](std::string message) {
+        unicastMessage = message;
+    });
+
+    REQUIRE(bus.Freeze());
+    REQUIRE(bus.IsFrozen());
+
+    SECTION("冻结后发布结果不变") {
+        REQUIRE(bus.Publish("frozen_event_42", 1).success);
+        REQUIRE(multicastSum == 43);
+        REQUIRE(bus.PublishUnicast("frozen_unicast", std::string("hello")).success);
+        REQUIRE(unicastMessage == "hello");
+        REQUIRE_FALSE(bus.Publish("frozen_missing", 1).success);
+        REQUIRE(bus.IsFrozen());
+    }
+
+    SECTION("已有事件键增删订阅者保持冻结") {
+        auto token = bus.Subscribe("frozen_event_1", [&](int value) {
+            multicastSum += value * 100;
+        });
+        REQUIRE(bus.IsFrozen());
+        bus.Publish("frozen_event_1", 1);
+        REQUIRE(multicastSum == 102);
+
+        REQUIRE(bus.Unsubscribe(token));
+        REQUIRE(bus.IsFrozen());
+        bus.Publish("frozen_event_1", 1);
+        REQUIRE(multicastSum == 104);
+    }
+
+    SECTION("事件键全部退订后发布失败") {
+        int onceCount = 0;
+        bus.SubscribeUnicast("frozen_unicast", [&](std::string) { onceCount++; }, std::string(), true);
+        REQUIRE(bus.IsFrozen());
+        REQUIRE(bus.PublishUnicast("frozen_unicast", std::string("once")).success);
+        REQUIRE(onceCount == 1);
+        REQUIRE_FALSE(bus.PublishUnicast("frozen_unicast", std::string("again")).success);
+        REQUIRE(onceCount == 1);
+    }
+
+    SECTION("多播一次性订阅者随处理器一起查找") {
+        int onceCount = 0;
+        bus.Subscribe("frozen_event_3", [&](int) { onceCount++; }, std::string(), true);
+        REQUIRE(bus.IsFrozen());
+        REQUIRE(bus.Publish("frozen_event_3", 1).totalSubscribers == 2);
+        REQUIRE(bus.Publish("frozen_event_3", 1).totalSubscribers == 1);
+        REQUIRE(onceCount == 1);
+        REQUIRE(multicastSum == 8);
+    }
+
+    SECTION("订阅新事件键自动解冻") {
+        bool called = false;
+        bus.Subscribe("frozen_new_event", [&]() { called = true; });
+        REQUIRE_FALSE(bus.IsFrozen());
+        REQUIRE(bus.Publish("frozen_new_event").success);
+        REQUIRE(called);
+        REQUIRE(bus.Freeze());
+    }
+}
+
+TEST_CASE("FrozenKeyIndex 最小完美哈希测试", "[EventBus][Freeze]") {
+    SECTION("每个键映射到唯一槽位") {
+        std::vector<std::string> keys;
+        for (int i = 0; i < 5000; ++i) {
+            keys.push_back("key_" + std::to_string(i));
+        }
+        FrozenKeyIndex<std::string> index;
+        REQUIRE(index.Build(keys));
+        REQUIRE(index.Size() == keys.size());
+
+        std::vector<bool> used(keys.size(), false);
+        for (const auto& key : keys) {
+            size_t slot = index.Find(key);
+            REQUIRE(slot < keys.size());
+            REQUIRE_FALSE(used[slot]);
+            used[slot] = true;
+            REQUIRE(index.KeyAt(slot) == key);
+        }
+        REQUIRE(index.Find("not_a_key") == FrozenKeyIndex<std::string>::npos);
+    }
+
+    SECTION("哈希值相同的键无法冻结") {
+        FrozenKeyIndex<TestEventType, TestEventTypeHash> index;
+        REQUIRE(index.Build({ TestEventType::EVENT_A, TestEventType::EVENT_B }));
+
+        struct ConstantHash {
+            std::size_t operator()(int) const { return 7; }
+        };
+        FrozenKeyIndex<int, ConstantHash> collided;
+        REQUIRE_FALSE(collided.Build({ 1, 2 }));
+        REQUIRE(collided.Empty());
+    }
+
+    SECTION("连续整数哈希的键（如StaticString的ID）") {
+        struct IdentityHash {
+            std::size_t operator()(int value) const { return static_cast<std::size_t>(value); }
+        };
+        std::vector<int> keys;
+        for (int i = 0; i < 20000; ++i) {
+            keys.push_back(i);
+        }
+        FrozenKeyIndex<int, IdentityHash> index;
+        REQUIRE(index.Build(keys));
+        for (int key : keys) {
+            REQUIRE(index.KeyAt(index.Find(key)) == key);
+        }
+        REQUIRE(index.Find(20000) == FrozenKeyIndex<int, IdentityHash>::npos);
+    }
+}
+
 // 性能测试（可选，需要CATCH_CONFIG_ENABLE_BENCHMARK）
 #ifdef CATCH_CONFIG_ENABLE_BENCHMARK
 TEST_CASE("EventBus 性能测试", "[.][benchmark]") {
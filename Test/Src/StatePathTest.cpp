@@ -1,6 +1,10 @@
 ﻿#include <iostream>
 #include <string>
 #include <memory>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <stdexcept>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_session.hpp>
 #include <EditorKit/StatePath.h>
@@ -375,4 +379,455 @@ TEST_CASE("性能测试", "[StatePath][Performance]")
     }
 
     system.removeEventListener(listener);
-}
\ No newline at end of file
+}
+
+TEST_CASE("异步监听器测试", "[StatePath][Async]")
+{
+    StatePath system;
+    std::vector<PathEventRecord> records;
+
+    SECTION("在投递点按顺序投递")
+    {
+        int syncCount = 0;
+        system.addEventListener("doc", ListenGranularity::ALL_CHILDREN,
+            EventType::UPDATE, [&](const PathEvent& event) { syncCount++; });
+        system.addAsyncEventListener("doc", ListenGranularity::ALL_CHILDREN,
+            EventType::UPDATE, [&](const PathEventRecord& record) { records.push_back(record); });
+
+        system.setInt("doc/count", 1);
+        system.setInt("doc/count", 2);
+        system.setString("doc/name", "a");
+        system.setString("doc/name", "b");
+        system.setInt("doc/count", 3);
+
+        REQUIRE(syncCount == 3);      // 同步监听器保持即时调用
+        REQUIRE(records.empty());     // 异步监听器等待投递
+        REQUIRE(system.getPendingAsyncEventCount() == 3);
+
+        REQUIRE(system.dispatchAsyncEvents() == 3);
+        REQUIRE(records.size() == 3);
+        REQUIRE(records[0].path == "doc/count");
+        REQUIRE(std::get<int>(records[0].value) == 2);
+        REQUIRE(records[1].nodeType == NodeType::STRING);
+        REQUIRE(std::get<std::string>(records[1].value) == "b");
+        REQUIRE(std::get<int>(records[2].value) == 3);
+    }
+
+    SECTION("移除后不再投递")
+    {
+        auto id = system.addAsyncEventListener("doc", ListenGranularity::ALL_CHILDREN,
+            EventType::ADD, [&](const PathEventRecord& record) { records.push_back(record); });
+
+        system.setInt("doc/value", 1);
+        system.removeEventListener(id);
+
+        REQUIRE(system.dispatchAsyncEvents() == 0);
+        REQUIRE(records.empty());
+    }
+
+    SECTION("调度线程投递")
+    {
+        std::atomic<int> delivered{ 0 };
+        std::atomic<int> lastValue{ 0 };
+        system.addAsyncEventListener("doc/value", ListenGranularity::NODE,
+            EventType::UPDATE, [&](const PathEventRecord& record)
+            {
+                lastValue = std::get<int>(record.value);
+                delivered++;
+            });
+
+        system.setInt("doc/value", 0);
+        system.startAsyncDispatcher();
+        for (int i = 1; i <= 100; i++)
+        {
+            system.setInt("doc/value", i);
+        }
+
+        for (int i = 0; i < 200 && delivered < 100; i++)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        system.stopAsyncDispatcher();
+
+        REQUIRE(delivered == 100);
+        REQUIRE(lastValue == 100);
+    }
+
+    SECTION("回调中再次投递不会死锁")
+    {
+        int delivered = 0;
+        system.addAsyncEventListener("doc/value", ListenGranularity::NODE,
+            EventType::UPDATE, [&](const PathEventRecord& record)
+            {
+                delivered++;
+                int value = std::get<int>(record.value);
+                if (value < 3)
+                {
+                    system.setInt("doc/value", value + 1);
+                    REQUIRE(system.dispatchAsyncEvents() == 0); // 重入时直接返回
+                }
+            });
+
+        system.setInt("doc/value", 0);
+        system.setInt("doc/value", 1);
+
+        // 回调中产生的事件由外层投递在同一次调用中继续投递
+        REQUIRE(system.dispatchAsyncEvents() == 3);
+        REQUIRE(delivered == 3);
+        REQUIRE(system.getPendingAsyncEventCount() == 0);
+    }
+
+    SECTION("回调抛出异常后仍可继续投递")
+    {
+        bool shouldThrow = true;
+        int delivered = 0;
+        system.addAsyncEventListener("doc/value", ListenGranularity::NODE,
+            EventType::UPDATE, [&](const PathEventRecord&)
+            {
+                delivered++;
+                if (shouldThrow)
+                {
+                    shouldThrow = false;
+                    throw std::runtime_error("listener failure");
+                }
+            });
+
+        system.setInt("doc/value", 0);
+        system.setInt("doc/value", 1);
+        system.setInt("doc/value", 2);
+        system.setInt("doc/value", 3);
+        REQUIRE_THROWS(system.dispatchAsyncEvents());
+        REQUIRE(delivered == 1);
+
+        // 抛出异常之后的事件放回队列，下次投递时按原顺序送达
+        REQUIRE(system.getPendingAsyncEventCount() == 2);
+        system.setInt("doc/value", 4);
+        REQUIRE(system.dispatchAsyncEvents() == 3);
+        REQUIRE(delivered == 4);
+    }
+}
+
+TEST_CASE("PathEvent路径引用测试", "[StatePath][PathRef]")
+{
+    StatePath system;
+    std::vector<std::string> paths;
+
+    SECTION("按需生成路径字符串")
+    {
+        system.addEventListener("scene", ListenGranularity::DIRECT_CHILD,
+            EventType::ADD, [&](const PathEvent& event)
+            {
+                REQUIRE(event.path == "scene/camera");
+                REQUIRE(event.relatedPath.empty());
+                paths.push_back(event.path.str());
+            });
+
+        system.setObject("scene/camera");
+        system.setInt("scene/camera/fov", 60); // 非直接子节点，不触发
+
+        REQUIRE(paths.size() == 1);
+        REQUIRE(paths[0] == "scene/camera");
+    }
+
+    SECTION("移动事件携带目标路径")
+    {
+        system.setInt("scene/a", 1);
+        system.addEventListener("scene/a", ListenGranularity::NODE,
+            EventType::MOVE, [&](const PathEvent& event)
+            {
+                paths.push_back(event.path + "->" + event.relatedPath.str());
+            });
+
+        system.moveNode("scene/a", "scene/b");
+
+        REQUIRE(paths.size() == 1);
+        REQUIRE(paths[0] == "scene/a->scene/b");
+    }
+}
+
+TEST_CASE("合并投递监听器测试", "[StatePath][Batched]")
+{
+    StatePath system;
+    std::vector<std::vector<std::string>> batches;
+    auto recordBatch = [&](const std::vector<std::string>& paths) { batches.push_back(paths); };
+
+    SECTION("每帧合并")
+    {
+        system.addBatchedEventListener("doc", ListenGranularity::ALL_CHILDREN, EventType::ADD,
+            DeliveryPolicy::COALESCED_PER_FRAME, recordBatch);
+
+        system.setInt("doc/a", 1);
+        system.setInt("doc/b", 2);
+        system.removeNode("doc/a");
+        system.setInt("doc/a", 3);
+
+        REQUIRE(batches.empty());
+        REQUIRE(system.flushBatchedEvents() == 1);
+        REQUIRE(batches.size() == 1);
+        REQUIRE(batches[0] == std::vector<std::string>{ "doc/a", "doc/b" });
+
+        REQUIRE(system.flushBatchedEvents() == 0); // 没有新变更
+        system.setInt("doc/c", 4);
+        system.flushBatchedEvents();
+        REQUIRE(batches.size() == 2);
+        REQUIRE(batches[1] == std::vector<std::string>{ "doc/c" });
+    }
+
+    SECTION("回调抛出异常后其余监听器仍可投递")
+    {
+        bool shouldThrow = true;
+        system.addBatchedEventListener("doc", ListenGranularity::ALL_CHILDREN, EventType::ADD,
+            DeliveryPolicy::COALESCED_PER_FRAME, [&](const std::vector<std::string>&)
+            {
+                if (shouldThrow)
+                {
+                    shouldThrow = false;
+                    throw std::runtime_error("listener failure");
+                }
+            });
+        system.addBatchedEventListener("doc", ListenGranularity::ALL_CHILDREN, EventType::ADD,
+            DeliveryPolicy::COALESCED_PER_FRAME, recordBatch);
+
+        system.setInt("doc/a", 1);
+        REQUIRE_THROWS(system.flushBatchedEvents());
+        REQUIRE(batches.empty());
+
+        // 未投递的监听器保留在待投递列表中
+        REQUIRE(system.flushBatchedEvents() == 1);
+        REQUIRE(batches.size() == 1);
+        REQUIRE(batches[0] == std::vector<std::string>{ "doc/a" });
+
+        // 两个监听器之后都能正常收到新的变更
+        system.setInt("doc/b", 2);
+        REQUIRE(system.flushBatchedEvents() == 2);
+        REQUIRE(batches.size() == 2);
+        REQUIRE(batches[1] == std::vector<std::string>{ "doc/b" });
+    }
+
+    SECTION("限制频率")
+    {
+        system.setInt("status/count", 0);
+        system.addBatchedEventListener("status/count", ListenGranularity::NODE, EventType::UPDATE,
+            DeliveryPolicy::MAX_RATE, recordBatch, 1.0);
+
+        system.setInt("status/count", 1);
+        REQUIRE(system.flushBatchedEvents() == 1);
+
+        system.setInt("status/count", 2);
+        system.setInt("status/count", 3);
+        REQUIRE(system.flushBatchedEvents() == 0); // 间隔未到，保持待投递
+        REQUIRE(batches.size() == 1);
+    }
+
+    SECTION("立即投递与移除")
+    {
+        auto id = system.addBatchedEventListener("doc", ListenGranularity::DIRECT_CHILD, EventType::ADD,
+            DeliveryPolicy::IMMEDIATE, recordBatch);
+        system.setInt("doc/x", 1);
+        REQUIRE(batches.size() == 1);
+
+        auto batchedId = system.addBatchedEventListener("doc", ListenGranularity::DIRECT_CHILD, EventType::ADD,
+            DeliveryPolicy::COALESCED_PER_FRAME, recordBatch);
+        system.removeEventListener(id);
+        system.setInt("doc/y", 2);
+        system.removeEventListener(batchedId);
+
+        REQUIRE(system.flushBatchedEvents() == 0);
+        REQUIRE(batches.size() == 1);
+    }
+}
+
+TEST_CASE("子树静音测试", "[StatePath][Mute]")
+{
+    StatePath system;
+    std::vector<std::string> paths;
+    system.addEventListener("doc", ListenGranularity::ALL_CHILDREN, EventType::ADD,
+        [&](const PathEvent& event) { paths.push_back(event.path); });
+    system.addEventListener("ui", ListenGranularity::ALL_CHILDREN, EventType::ADD,
+        [&](const PathEvent& event) { paths.push_back(event.path); });
+
+    SECTION("只静音指定子树")
+    {
+        {
+            auto guard = system.muteSubtreeScoped("doc/layers");
+            system.setInt("doc/layers/a", 1);
+            system.setInt("doc/layers/b/c", 2);
+            system.setInt("doc/title", 3);
+            system.setInt("ui/panel", 4);
+        }
+        system.setInt("doc/layers/d", 5);
+
+        REQUIRE(paths == std::vector<std::string>{ "doc/title", "ui/panel", "doc/layers/d" });
+    }
+
+    SECTION("嵌套静音")
+    {
+        system.muteSubtree("doc");
+        system.muteSubtree("doc");
+        REQUIRE(system.unmuteSubtree("doc") == true);
+        system.setInt("doc/a", 1);
+        REQUIRE(paths.empty());
+
+        REQUIRE(system.unmuteSubtree("doc") == true);
+        REQUIRE(system.unmuteSubtree("doc") == false);
+        system.setInt("doc/b", 2);
+        REQUIRE(paths.size() == 1);
+    }
+
+    SECTION("取消静音与注销监听器后回收空节点")
+    {
+        size_t baseline = system.getListenerNodeCount();
+        system.muteSubtree("doc/layers/a/b");
+        system.muteSubtree("tmp/x");
+        REQUIRE(system.getListenerNodeCount() == baseline + 5);
+
+        REQUIRE(system.unmuteSubtree("doc/layers/a/b") == true);
+        REQUIRE(system.unmuteSubtree("tmp/x") == true);
+        REQUIRE(system.getListenerNodeCount() == baseline);
+
+        // 仍有监听器或静音的节点保留
+        ListenerId id = system.addEventListener("doc/layers/a", ListenGranularity::NODE, EventType::ADD,
+            [&](const PathEvent& event) { paths.push_back(event.path); });
+        system.muteSubtree("doc/layers/a/b");
+        REQUIRE(system.unmuteSubtree("doc/layers/a/b") == true);
+        REQUIRE(system.getListenerNodeCount() == baseline + 2);
+
+        REQUIRE(system.removeEventListener(id) == true);
+        REQUIRE(system.getListenerNodeCount() == baseline);
+
+        system.setInt("doc/layers/c", 1);
+        REQUIRE(paths == std::vector<std::string>{ "doc/layers/c" });
+    }
+}
+
+TEST_CASE("延迟分发测试", "[StatePath][Deferred]")
+{
+    StatePath system;
+    std::vector<std::string> order;
+    std::vector<std::string> errors;
+    system.setErrorCallback([&](const char* msg) { errors.push_back(msg); });
+    system.setDeferredDispatch(true);
+
+    SECTION("广度优先处理回调中产生的事件")
+    {
+        system.addEventListener("a", ListenGranularity::NODE, EventType::ADD, [&](const PathEvent& event)
+            {
+                order.push_back("a:begin");
+                system.setInt("b", 1);
+                system.setInt("c", 1);
+                order.push_back("a:end");
+            });
+        system.addEventListener("b", ListenGranularity::NODE, EventType::ADD, [&](const PathEvent& event)
+            {
+                order.push_back("b");
+                system.setInt("d", 1);
+            });
+        system.addEventListener("c", ListenGranularity::NODE, EventType::ADD, [&](const PathEvent& event)
+            {
+                order.push_back("c");
+            });
+        system.addEventListener("d", ListenGranularity::NODE, EventType::ADD, [&](const PathEvent& event)
+            {
+                order.push_back("d");
+                REQUIRE(event.node == system.getNode("d"));
+            });
+
+        system.setInt("a", 1);
+
+        REQUIRE(order == std::vector<std::string>{ "a:begin", "a:end", "b", "c", "d" });
+        REQUIRE(errors.empty());
+    }
+
+    SECTION("循环检测")
+    {
+        int pingCount = 0;
+        system.setInt("ping", 0);
+        system.setInt("pong", 0);
+        system.addEventListener("ping", ListenGranularity::NODE, EventType::UPDATE, [&](const PathEvent& event)
+            {
+                pingCount++;
+                system.setInt("pong", system.GetIntValue("pong") + 1);
+            });
+        system.addEventListener("pong", ListenGranularity::NODE, EventType::UPDATE, [&](const PathEvent& event)
+            {
+                system.setInt("ping", system.GetIntValue("ping") + 1);
+            });
+
+        system.setInt("ping", 1);
+
+        REQUIRE(pingCount == 1);
+        REQUIRE(errors.size() == 1);
+    }
+
+    SECTION("不同起因对同一路径的重复修改不视为循环")
+    {
+        int counterEvents = 0;
+        system.setInt("source", 0);
+        system.setInt("counter", 0);
+        system.addEventListener("source", ListenGranularity::NODE, EventType::UPDATE, [&](const PathEvent& event)
+            {
+                system.setInt("counter", system.GetIntValue("counter") + 1);
+            });
+        system.addEventListener("source", ListenGranularity::NODE, EventType::UPDATE, [&](const PathEvent& event)
+            {
+                system.setInt("counter", system.GetIntValue("counter") + 1);
+            });
+        system.addEventListener("counter", ListenGranularity::NODE, EventType::UPDATE, [&](const PathEvent& event)
+            {
+                counterEvents++;
+            });
+
+        system.setInt("source", 1);
+
+        REQUIRE(system.GetIntValue("counter") == 2);
+        REQUIRE(counterEvents == 2);
+        REQUIRE(errors.empty());
+    }
+
+    SECTION("回调抛出异常后丢弃未处理的延迟事件")
+    {
+        int laterEvents = 0;
+        system.addEventListener("fail", ListenGranularity::NODE, EventType::ADD, [&](const PathEvent& event)
+            {
+                system.setInt("pending", 1);
+                throw std::runtime_error("listener failure");
+            });
+        system.addEventListener("pending", ListenGranularity::NODE, EventType::ADD, [&](const PathEvent& event)
+            {
+                laterEvents++;
+            });
+        system.addEventListener("next", ListenGranularity::NODE, EventType::ADD, [&](const PathEvent& event)
+            {
+                system.setInt("next_child", 1);
+            });
+        int childEvents = 0;
+        system.addEventListener("next_child", ListenGranularity::NODE, EventType::ADD, [&](const PathEvent& event)
+            {
+                childEvents++;
+            });
+
+        REQUIRE_THROWS(system.setInt("fail", 1));
+
+        // 之后的事件正常分发，且不会带出上一轮残留的事件
+        system.setInt("next", 1);
+        REQUIRE(childEvents == 1);
+        REQUIRE(laterEvents == 0);
+        REQUIRE(errors.empty());
+    }
+
+    SECTION("传播数量限制")
+    {
+        system.setMaxEventPropagation(10);
+        system.addEventListener("chain", ListenGranularity::DIRECT_CHILD, EventType::ADD, [&](const PathEvent& event)
+            {
+                int next = std::stoi(event.path.str().substr(6)) + 1;
+                system.setInt("chain/" + std::to_string(next), next);
+            });
+
+        system.setInt("chain/0", 0);
+
+        REQUIRE(system.hasNode("chain/11") == true);
+        REQUIRE(system.hasNode("chain/12") == false);
+        REQUIRE(errors.size() == 1);
+    }
+}
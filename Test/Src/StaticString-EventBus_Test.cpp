@@ -2,6 +2,15 @@
 #include <catch2/matchers/catch_matchers_string.hpp>
 #include <EditorKit/KEventBus.h>
 #include <EditorKit/StaticString.h>
+#include <filesystem>
+#include <fstream>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <algorithm>
 
 TEST_CASE("EventBus with StaticString key type", "[EventBus][StaticString]")
 {
@@ -291,9 +300,462 @@ TEST_CASE("StaticString
         REQUIRE(empty1.str().empty());
     }
 }
+
+TEST_CASE("StaticString string_view", "[StaticString]")
+{
+    SECTION("ͼҪԿַβ")
+    {
+        std::string_view source = "view_key_suffix";
+        StaticString fromView(source.substr(0, 8));
+        REQUIRE(fromView == StaticString("view_key"));
+        REQUIRE(fromView.str() == "view_key");
+        REQUIRE(std::string(fromView.c_str()) == "view_key");
+    }
+
+    SECTION("ԴͬݵõͬID")
+    {
+        std::string text = "view_same";
+        REQUIRE(StaticString(text) == StaticString(std::string_view(text)));
+        REQUIRE(StaticString(text) == StaticString("view_same"));
+        REQUIRE(StaticString(text) == StaticString("view_same"_ss));
+    }
+
+    SECTION("std::stringפ")
+    {
+        std::string withNull("a\0b", 3);
+        StaticString embedded(withNull);
+        REQUIRE(embedded.str() == withNull);
+        REQUIRE(embedded != StaticString("a"));
+    }
+}
+
+TEST_CASE("StaticStringBuilderӳפ", "[StaticString]")
+{
+    SECTION("ƴӹ̲פм")
+    {
+        auto before = StaticString::getPoolStatistics();
+        StaticStringBuilder builder;
+        builder.append("builder_").append(std::string("key")).append('_').appendNumber(-42);
+        builder += StaticString("_tail");
+        auto afterAppend = StaticString::getPoolStatistics();
+        REQUIRE(builder.view() == "builder_key_-42_tail");
+        // ֻ"_tail"һפѴڣ
+        REQUIRE(afterAppend.stringCount - before.stringCount <= 1);
+
+        StaticString committed = builder.commit();
+        REQUIRE(committed == StaticString("builder_key_-42_tail"));
+        REQUIRE(StaticString::getPoolStatistics().stringCount == afterAppend.stringCount + 1);
+    }
+
+    SECTION("תѻ")
+    {
+        StaticStringBuilder builder;
+        std::string expected;
+        for (int i = 0; i < 100; ++i)
+        {
+            builder.append("segment");
+            expected += "segment";
+        }
+        REQUIRE(builder.size() > StaticStringBuilder::InlineCapacity);
+        REQUIRE(builder.view() == expected);
+        REQUIRE(builder.commit().str() == expected);
+    }
+
+    SECTION("clear")
+    {
+        StaticStringBuilder builder("reuse_");
+        builder.appendNumber(1);
+        REQUIRE(builder.commit().str() == "reuse_1");
+        builder.clear();
+        REQUIRE(builder.empty());
+        builder.append("reuse_").appendNumber(2);
+        REQUIRE(builder.commit().str() == "reuse_2");
+    }
+
+    SECTION("ͳַ")
+    {
+        auto before = StaticString::getPoolStatistics();
+        StaticString fresh("pool_statistics_unique_key");
+        StaticString again("pool_statistics_unique_key");
+        auto after = StaticString::getPoolStatistics();
+        REQUIRE(fresh == again);
+        REQUIRE(after.stringCount == before.stringCount + 1);
+        REQUIRE(after.totalBytes == before.totalBytes + std::string("pool_statistics_unique_key").size());
+    }
+}
+
+TEST_CASE("StaticStringʱפ", "[StaticString]")
+{
+    SECTION("մ洢òλ")
+    {
+        auto before = StaticString::getPoolStatistics();
+        int firstId = 0;
+        {
+            StaticString::TransientScope scope;
+            StaticString temp = scope.intern("transient_object_1");
+            firstId = temp.id();
+            REQUIRE(temp.isTransient());
+            REQUIRE(temp.str() == "transient_object_1");
+            REQUIRE(scope.intern("transient_object_1") == temp);
+            REQUIRE(scope.size() == 1);
+
+            auto during = StaticString::getPoolStatistics();
+            REQUIRE(during.stringCount == before.stringCount);
+            REQUIRE(during.transientCount == before.transientCount + 1);
+        }
+        auto after = StaticString::getPoolStatistics();
+        REQUIRE(after.transientCount == before.transientCount);
+        REQUIRE(after.transientBytes == before.transientBytes);
+
+        // IDȡΪմõĲλõͬID
+        StaticString::TransientScope scope;
+        StaticString reused = scope.intern("transient_object_2");
+        REQUIRE(reused.id() != firstId);
+        REQUIRE(reused.str() == "transient_object_2");
+    }
+
+    SECTION("ͬһʱַ")
+    {
+        auto outer = std::make_unique<StaticString::TransientScope>();
+        StaticString a = outer->intern("transient_shared");
+        {
+            StaticString::TransientScope inner;
+            REQUIRE(inner.intern("transient_shared") == a);
+        }
+        REQUIRE(a.str() == "transient_shared");
+        outer.reset();
+        REQUIRE(a.str().empty());
+    }
+
+    SECTION("פıID")
+    {
+        StaticString permanent("transient_already_permanent");
+        StaticString::TransientScope scope;
+        StaticString interned = scope.intern("transient_already_permanent");
+        REQUIRE(interned == permanent);
+        REQUIRE_FALSE(interned.isTransient());
+        REQUIRE(scope.size() == 0);
+    }
+
+    SECTION("ڼ䱻פı̶")
+    {
+        StaticString pinned;
+        {
+            StaticString::TransientScope scope;
+            pinned = scope.intern("transient_then_permanent");
+            REQUIRE(pinned.isTransient());
+            REQUIRE(StaticString("transient_then_permanent") == pinned);
+            REQUIRE_FALSE(pinned.isTransient());
+        }
+        REQUIRE_FALSE(pinned.isTransient());
+        REQUIRE(pinned.str() == "transient_then_permanent");
+        REQUIRE(StaticString("transient_then_permanent") == pinned);
+    }
+}
+
+namespace
+{
+    // savePoolļʽ汾2дַбpinnedΪ̶ַ
+    std::vector<std::string> readPoolFile(const std::string& path, std::vector<std::string>* pinned = nullptr)
+    {
+        std::ifstream file(path, std::ios::binary);
+        std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        uint32_t count = 0;
+        uint32_t pinnedCount = 0;
+        std::memcpy(&count, content.data() + 8, sizeof(count));
+        std::memcpy(&pinnedCount, content.data() + 12, sizeof(pinnedCount));
+        std::vector<uint32_t> offsets(count + pinnedCount + 1);
+        std::memcpy(offsets.data(), content.data() + 16, offsets.size() * sizeof(uint32_t));
+        const char* blob = content.data() + 16 + offsets.size() * sizeof(uint32_t);
+        std::vector<std::string> strings;
+        for (uint32_t i = 0; i < count + pinnedCount; ++i)
+        {
+            std::string text(blob + offsets[i], offsets[i + 1] - offsets[i]);
+            if (i < count)
+            {
+                strings.push_back(std::move(text));
+            }
+            else if (pinned)
+            {
+                pinned->push_back(std::move(text));
+            }
+        }
+        return strings;
+    }
+
+    void writePoolFile(const std::string& path, const std::vector<std::string>& strings,
+        const std::vector<std::string>& pinned = {})
+    {
+        std::vector<uint32_t> offsets{ 0 };
+        std::string blob;
+        for (const auto* list : { &strings, &pinned })
+        {
+            for (const auto& str : *list)
+            {
+                blob += str;
+                offsets.push_back(static_cast<uint32_t>(blob.size()));
+            }
+        }
+        uint32_t version = 2;
+        uint32_t count = static_cast<uint32_t>(strings.size());
+        uint32_t pinnedCount = static_cast<uint32_t>(pinned.size());
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write("SSPL", 4);
+        file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+        file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        file.write(reinterpret_cast<const char*>(&pinnedCount), sizeof(pinnedCount));
+        file.write(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(uint32_t));
+        file.write(blob.data(), blob.size());
+    }
+
+    // ÿʹòͬʱļⲢеĲԻา
+    std::string uniqueTempPath(const std::string& prefix)
+    {
+        static std::atomic<int> counter{ 0 };
+        auto tick = std::chrono::steady_clock::now().time_since_epoch().count();
+        std::ostringstream name;
+        name << prefix << "_" << std::hash<std::thread::id>()(std::this_thread::get_id()) << "_" << tick << "_" << counter++ << ".bin";
+        return (std::filesystem::temp_directory_path() / name.str()).string();
+    }
+}
+
+TEST_CASE("StaticStringַس־û", "[StaticString]")
+{
+    std::string path = uniqueTempPath("editorkit_static_string_pool");
+    StaticString known("persist_known_key");
+    REQUIRE(StaticString::savePool(path));
+
+    SECTION("ļID˳¼ȫַ")
+    {
+        auto strings = readPoolFile(path);
+        REQUIRE(strings.size() > static_cast<size_t>(known.id()));
+        REQUIRE(strings[known.id()] == "persist_known_key");
+    }
+
+    SECTION("ͬļıID")
+    {
+        auto before = StaticString::getPoolStatistics();
+        REQUIRE(StaticString::loadPool(path));
+        REQUIRE(StaticString::getPoolStatistics().stringCount == before.stringCount);
+        REQUIRE(StaticString("persist_known_key") == known);
+    }
+
+    SECTION("ַIDļеλһ")
+    {
+        auto strings = readPoolFile(path);
+        size_t firstNew = strings.size();
+        strings.push_back("persist_loaded_key_1");
+        strings.push_back("persist_loaded_key_2");
+        writePoolFile(path, strings);
+
+        REQUIRE(StaticString::loadPool(path));
+        REQUIRE(StaticString("persist_loaded_key_1").id() == static_cast<int>(firstNew));
+        REQUIRE(StaticString("persist_loaded_key_2").id() == static_cast<int>(firstNew + 1));
+        REQUIRE(StaticString("persist_loaded_key_2").str() == "persist_loaded_key_2");
+    }
+
+    SECTION("뵱ǰIDͻļܾ")
+    {
+        auto strings = readPoolFile(path);
+        strings[known.id()] = "persist_conflicting_key";
+        writePoolFile(path, strings);
+        REQUIRE_FALSE(StaticString::loadPool(path));
+        REQUIRE(StaticString("persist_known_key") == known);
+    }
+
+    SECTION("̶ַļ棬´μʱID")
+    {
+        StaticString pinned;
+        {
+            StaticString::TransientScope scope;
+            pinned = scope.intern("persist_pinned_key");
+            REQUIRE(StaticString("persist_pinned_key") == pinned);
+        }
+        REQUIRE(StaticString::savePool(path));
+
+        std::vector<std::string> pinnedTexts;
+        auto strings = readPoolFile(path, &pinnedTexts);
+        REQUIRE(std::find(pinnedTexts.begin(), pinnedTexts.end(), "persist_pinned_key") != pinnedTexts.end());
+        REQUIRE(std::find(strings.begin(), strings.end(), "persist_pinned_key") == strings.end());
+
+        // ̶ַIDļ棺ļܷIDID֮󣬲뱣ʱʱIDͬ
+        REQUIRE(static_cast<size_t>(pinned.id()) >= strings.size() + pinnedTexts.size());
+
+        // ǰиıID¼ʱڶID
+        REQUIRE(StaticString::loadPool(path));
+        REQUIRE(StaticString("persist_pinned_key") == pinned);
+
+        // ̶δפı˳׷Ϊַ
+        size_t nextPermanent = static_cast<size_t>(StaticString("persist_pinned_probe").id()) + 1;
+        strings = readPoolFile(path);
+        writePoolFile(path, strings, { "persist_pinned_key", "persist_pinned_new" });
+        REQUIRE(StaticString::loadPool(path));
+        REQUIRE(StaticString("persist_pinned_new").id() == static_cast<int>(nextPermanent));
+    }
+
+    SECTION("ʱеıID")
+    {
+        StaticString::TransientScope scope;
+        StaticString held = scope.intern("persist_held_transient");
+        auto strings = readPoolFile(path);
+        strings.push_back("persist_held_transient");
+        writePoolFile(path, strings);
+
+        REQUIRE_FALSE(StaticString::loadPool(path));
+        REQUIRE(scope.intern("persist_held_transient") == held);
+    }
+
+    SECTION("𻵻򲻴ڵļܾ")
+    {
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << "garbage";
+        REQUIRE_FALSE(StaticString::loadPool(path));
+        REQUIRE_FALSE(StaticString::loadPool(path + ".missing"));
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("StaticStringڴ洢", "[StaticString]")
+{
+    SECTION("ͼCֱַָ洢")
+    {
+        StaticString key("arena_view_key");
+        REQUIRE(key.view() == "arena_view_key");
+        REQUIRE(key.c_str() == key.view().data());
+        REQUIRE(key.c_str()[key.view().size()] == '\0');
+        REQUIRE(StaticString("arena_view_key").c_str() == key.c_str());
+    }
+
+    SECTION("ַ")
+    {
+        std::string longText(20000, 'x');
+        StaticString key(longText);
+        REQUIRE(key.view() == longText);
+    }
+
+    SECTION("str()贴ĸΨһȶ")
+    {
+        StaticString key("arena_materialize_key");
+        std::vector<const std::string*> addresses(4);
+        std::vector<std::thread> readers;
+        for (size_t t = 0; t < addresses.size(); ++t)
+        {
+            readers.emplace_back([&, t]() { addresses[t] = &key.str(); });
+        }
+        for (auto& reader : readers)
+        {
+            reader.join();
+        }
+        for (const auto* address : addresses)
+        {
+            REQUIRE(address == &key.str());
+        }
+        REQUIRE(key.str() == "arena_materialize_key");
+    }
+
+    SECTION("view()str()ĸͳֻһ")
+    {
+        StaticString key("arena_materialize_stat_key");
+        auto before = StaticString::getPoolStatistics();
+        REQUIRE(key.view() == "arena_materialize_stat_key");
+        REQUIRE(std::string_view(key.c_str()) == "arena_materialize_stat_key");
+        REQUIRE(StaticString::getPoolStatistics().materializedBytes == before.materializedBytes);
+
+        key.str();
+        key.str();
+        auto after = StaticString::getPoolStatistics();
+        REQUIRE(after.materializedBytes == before.materializedBytes + key.view().size());
+    }
+}
+
+TEST_CASE("StaticString̱߳زһ", "[StaticString]")
+{
+    SECTION("ظͬһַл")
+    {
+        const char* key = "thread_cache_key";
+        StaticString first(key);
+        StaticString::resetThreadCacheStatistics();
+        for (int i = 0; i < 100; ++i)
+        {
+            REQUIRE(StaticString(key) == first);
+        }
+        auto stats = StaticString::getThreadCacheStatistics();
+        REQUIRE(stats.hits == 100);
+        REQUIRE(stats.misses == 0);
+        REQUIRE(stats.hitRate() == 1.0);
+    }
+
+    SECTION("ͬһַݸıʱ")
+    {
+        char buffer[] = "thread_cache_a";
+        StaticString a(buffer);
+        buffer[sizeof(buffer) - 2] = 'b';
+        StaticString b(buffer);
+        REQUIRE(a != b);
+        REQUIRE(b.str() == "thread_cache_b");
+        REQUIRE(StaticString(buffer) == b);
+    }
+
+    SECTION("̻߳ͳ໥")
+    {
+        StaticString::resetThreadCacheStatistics();
+        StaticString::ThreadCacheStatistics workerStats{};
+        int workerId = -1;
+        std::thread worker([&]()
+            {
+                for (int i = 0; i < 10; ++i)
+                {
+                    workerId = StaticString("thread_cache_worker").id();
+                }
+                workerStats = StaticString::getThreadCacheStatistics();
+            });
+        worker.join();
+        REQUIRE(workerStats.hits + workerStats.misses == 10);
+        REQUIRE(workerStats.hits >= 9);
+        REQUIRE(StaticString::getThreadCacheStatistics().hits == 0);
+        REQUIRE(StaticString("thread_cache_worker").id() == workerId);
+    }
+}
+
+TEST_CASE("StaticString", "[StaticString]")
+{
+    SECTION("ϣڱڼ")
+    {
+        constexpr StaticStringLiteral literal = "compile_time_key"_ss;
+        static_assert(literal.size == 16, "Ӧڱȷ");
+        static_assert(literal.hash == StaticStringHash("compile_time_key", 16), "ϣӦڱȷ");
+        static_assert("a"_ss.hash != "b"_ss.hash, "ͬϣӦͬ");
+    }
+
+    SECTION("ʱַõͬID")
+    {
+        StaticString runtime("literal_key");
+        StaticString literal = "literal_key"_ss;
+        REQUIRE(runtime == literal);
+        REQUIRE(literal.str() == "literal_key");
+        REQUIRE(StaticString(""_ss) == StaticString());
+    }
+
+    SECTION("STATIC_STRINGõID")
+    {
+        auto lookup = []() { return STATIC_STRING("cached_key"); };
+        REQUIRE(lookup() == StaticString("cached_key"));
+        REQUIRE(&STATIC_STRING("cached_key") != nullptr);
+        REQUIRE(lookup().id() == lookup().id());
+
+        EventBus<StaticString> eventBus;
+        int count = 0;
+        auto token = eventBus.Subscribe(STATIC_STRING("cached_event"), [&]() { count++; });
+        eventBus.Publish(StaticString("cached_event"));
+        REQUIRE(count == 1);
+    }
+}
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/benchmark/catch_benchmark.hpp>
 #include <chrono>
+#include <thread>
+#include <atomic>
+#include <algorithm>
 #include <unordered_map>
 
 
@@ -541,3 +1003,130 @@ TEST_CASE("ʵ
     }
 }
 
+TEST_CASE("StaticStringַزȡ", "[StaticString][Concurrency]")
+{
+    SECTION("ַӰѷص")
+    {
+        StaticString first("pool_stable_reference");
+        const std::string& ref = first.str();
+        const char* cstr = first.c_str();
+
+        for (int i = 0; i < 5000; ++i)
+        {
+            StaticString(("pool_growth_" + std::to_string(i)).c_str());
+        }
+
+        REQUIRE(&ref == &first.str());
+        REQUIRE(cstr == first.c_str());
+        REQUIRE(ref == "pool_stable_reference");
+    }
+
+    SECTION("̶߳ȡ벢")
+    {
+        std::vector<StaticString> keys;
+        for (int i = 0; i < 256; ++i)
+        {
+            keys.push_back(StaticString(("pool_reader_key_" + std::to_string(i)).c_str()));
+        }
+
+        std::atomic<bool> stop{ false };
+        std::atomic<int> mismatches{ 0 };
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 4; ++t)
+        {
+            readers.emplace_back([&]()
+                {
+                    while (!stop)
+                    {
+                        for (int i = 0; i < 256; ++i)
+                        {
+                            if (keys[i].str() != "pool_reader_key_" + std::to_string(i))
+                            {
+                                mismatches++;
+                            }
+                        }
+                    }
+                });
+        }
+
+        for (int i = 0; i < 20000; ++i)
+        {
+            StaticString(("pool_writer_key_" + std::to_string(i)).c_str());
+        }
+        stop = true;
+        for (auto& reader : readers)
+        {
+            reader.join();
+        }
+
+        REQUIRE(mismatches == 0);
+    }
+}
+
+// ַ߳פܲ
+double concurrentInternTest(int threadCount, int stringsPerThread, const std::string& prefix)
+{
+    std::vector<std::thread> workers;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int t = 0; t < threadCount; ++t)
+    {
+        workers.emplace_back([=]()
+            {
+                for (int i = 0; i < stringsPerThread; ++i)
+                {
+                    StaticString((prefix + std::to_string(t) + "_" + std::to_string(i)).c_str());
+                }
+            });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+TEST_CASE("StaticStringפ", "[StaticString][Concurrency][Performance]")
+{
+    SECTION("פַͬõͬID")
+    {
+        const int THREAD_COUNT = 8;
+        const int KEY_COUNT = 2000;
+        std::vector<std::vector<int>> ids(THREAD_COUNT, std::vector<int>(KEY_COUNT));
+        std::vector<std::thread> workers;
+        for (int t = 0; t < THREAD_COUNT; ++t)
+        {
+            workers.emplace_back([&, t]()
+                {
+                    for (int i = 0; i < KEY_COUNT; ++i)
+                    {
+                        ids[t][i] = StaticString(("shared_intern_" + std::to_string(i)).c_str()).id();
+                    }
+                });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        for (int t = 1; t < THREAD_COUNT; ++t)
+        {
+            REQUIRE(ids[t] == ids[0]);
+        }
+        REQUIRE(StaticString("shared_intern_42").id() == ids[0][42]);
+        REQUIRE(StaticString("shared_intern_42").str() == "shared_intern_42");
+    }
+
+    SECTION("פ")
+    {
+        const int TOTAL_STRINGS = 200000;
+        unsigned int cores = std::max(2u, std::thread::hardware_concurrency());
+        std::cout << "\nַ߳פԣַ: " << TOTAL_STRINGS << std::endl;
+        std::cout << "==========================================" << std::endl;
+        double single = concurrentInternTest(1, TOTAL_STRINGS, "intern_bench_single_");
+        double multi = concurrentInternTest(static_cast<int>(cores), TOTAL_STRINGS / static_cast<int>(cores), "intern_bench_multi_");
+        std::cout << "߳פ - ʱ: " << single << " ΢" << std::endl;
+        std::cout << cores << " ߳פ - ʱ: " << multi << " ΢" << std::endl;
+        std::cout << "==========================================" << std::endl;
+    }
+}